@@ -0,0 +1,975 @@
+/*!
+*****************************************************************************
+\file   RasterBench.cpp
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains a benchmark driver for the rasterizer's inner loops,
+  reporting the throughput of each on its own (outside of a frame):
+
+    spans    - the Raster span writers, opaque and blended, in Mpx/s
+    fills    - flat (parallelogram), outlined tiles (filled then outlined,
+               and in one pass), Gouraud and textured (nearest/bilinear)
+               fills, in Mpx/s
+    lines    - aliased and smooth lines of 10, 40 and 160 pixels, in lines/s
+    shapes   - ellipses, circles and arcs (filled and outlined) of radius 8,
+               32 and 128, against the same shapes tessellated into a
+               FillTriangle fan and a DrawLine polyline, in us per shape
+    paths    - a circle of 4 cubic Beziers at radii from 0.5 to 512 pixels:
+               the lines FlattenPath cuts it into, and the time to flatten
+               and to draw it, against drawing it cut into a fixed 64 lines
+               per curve, in us per path
+    polygons - a check of BuildMeshLayout against 3000 random star polygons
+               (0 to 3 holes, either orientation), then the time to build
+               a batch of 5000 with BuildMeshLayouts, serially and split
+               across TaskPools of 1 thread per core and of 4 threads
+    meshes   - the memory OptimizeMeshLayout and PackMeshLayout save on the
+               CustomMesh and on a 300x300 grid with junk primitives and
+               shuffled vertices and faces, the time to optimize the grid,
+               and the time to transform it and walk its faces before and
+               after, in ms
+
+  It is built from this file, every source in ../src and the framework's
+  sources (which provide RasterUtilities.h, Affine.h and the like), with
+  ../src and the framework on the include path, at -O2. It is run as
+  "RasterBench [section...]" (every section when none is given).
+  Each case is run [gRepeats] times and the best run is reported, since the
+  best run is the one least disturbed by the rest of the machine.
+*******************************************************************************/
+#include "Affine.h"
+#include "Ellipse.h"
+#include "GouraudFill.h"
+#include "MeshBuilder.h"
+#include "MyMesh.h"
+#include "Path.h"
+#include "PolygonFill.h"
+#include "QuadFill.h"
+#include "Raster.h"
+#include "RasterUtilities.h"
+#include "SmoothLine.h"
+#include "Texture.h"
+#include "TextureFill.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <set>
+#include <vector>
+
+
+/*############################################################################*/
+/*############################# Global Constants #############################*/
+/*############################################################################*/
+
+  /* The size of the frame buffer drawn to. */
+static const int gBenchWidth  = 640;
+static const int gBenchHeight = 480;
+  /* Number of times each case is run (the best run is reported). */
+static const int gRepeats     = 7;
+  /* Number of times each fill case covers the frame buffer per run. */
+static const int gFillFrames  = 20;
+  /* Number of random lines drawn per run. */
+static const int gLineCount   = 200000;
+  /* The size of the texture the textured fills sample. */
+static const int gTextureSize = 256;
+  /* Number of tiles across (and down) the grid of outlined tiles filled. */
+static const int gTileGrid    = 8;
+  /* Number of shapes drawn per run (a tenth of it for the largest radius). */
+static const int gShapeCount  = 20000;
+  /* The largest number of segments a tessellated shape is made of. */
+static const int gMaxSegments = 128;
+  /* Number of paths flattened (or drawn) per run. */
+static const int gPathCount   = 2000;
+  /* Number of lines each curve is cut into by the fixed subdivision. */
+static const int gFixedSteps  = 64;
+  /* Number of random polygons checked, and built per batch. */
+static const int gCheckedPolygons = 3000;
+static const int gBatchPolygons   = 5000;
+  /* Number of vertices along each side of the grid mesh optimized. */
+static const int gGridSide        = 300;
+
+
+/*############################################################################*/
+/*########################## Local Helper Functions ##########################*/
+/*############################################################################*/
+
+  /* Run [fn] [gRepeats] times, returning the fastest run (in seconds). */
+template <typename Fn>
+static double BestRun(Fn fn)
+{
+  typedef std::chrono::steady_clock Clock;
+
+  double best = 1.0e30;
+  for (int i = 0; i < gRepeats; ++i)
+  {
+    Clock::time_point start = Clock::now();
+    fn();
+    best = std::min(best, std::chrono::duration<double>(Clock::now() - start).count());
+  }
+  return best;
+}
+
+  /* Print the throughput of a case that wrote [pixels] pixels in [seconds]. */
+static void ReportPixels(const char *name, double pixels, double seconds)
+{ std::printf("  %-28s %8.0f Mpx/s\n", name, ((pixels / seconds) / 1.0e6)); }
+
+  /*
+   * Tessellate the arc of the ellipse centered on [C] with radii [rx] and
+   * [ry] from [startAngle] to [endAngle] into [segments] segments, storing
+   * their [segments] + 1 ends in [points].
+   */
+static void TessellateArc(const Point &C, float rx, float ry, float startAngle,
+                          float endAngle, int segments, std::vector<Point> &points)
+{
+  points.clear();
+  for (int k = 0; k <= segments; ++k)
+  {
+    const float angle = (startAngle + (((endAngle - startAngle) * k) / segments));
+    points.push_back(Point((C.x + (rx * std::cos(angle))), (C.y + (ry * std::sin(angle)))));
+  }
+}
+
+  /* A random value within [min, max]. */
+static double RandomIn(double min, double max)
+{ return (min + ((max - min) * (static_cast<double>(std::rand()) / RAND_MAX))); }
+
+  /*
+   * Append a random star polygon to [points] and [contourEnds]: [n] points
+   * around ([cx], [cy]) at random distances from 0.6 to 1 times [radius],
+   * with [holes] small squares or regular polygons cut out of it, the
+   * boundary counterclockwise unless [flipBoundary] and the holes
+   * counterclockwise unless [flipHoles].
+   */
+static void StarPolygon(std::vector<Point> &points, std::vector<int> &contourEnds,
+                        double cx, double cy, double radius, int n, int holes,
+                        bool flipBoundary, bool flipHoles)
+{
+  const double turn  = 6.283185307;
+  const double inner = (0.6 * radius);
+  const int    first = static_cast<int>(points.size());
+  for (int i = 0; i < n; ++i)
+  {
+    const double angle = ((turn * i) / n);
+    const double r     = RandomIn(inner, radius);
+    points.push_back(Point(static_cast<float>(cx + (r * std::cos(angle))),
+                           static_cast<float>(cy + (r * std::sin(angle)))));
+  }
+  if (flipBoundary)
+    std::reverse(points.begin() + first, points.end());
+  contourEnds.push_back(static_cast<int>(points.size()));
+
+    /* The holes sit around a circle half way to the inner radius, apart from each other. */
+  for (int h = 0; h < holes; ++h)
+  {
+    const int    holeFirst = static_cast<int>(points.size());
+    const double angle     = (((turn * h) / holes) + 0.1);
+    const double size      = std::min((0.4 * inner * std::sin(3.14159 / std::max(holes, 2))),
+                                      (0.3 * inner));
+    const double hx        = (cx + (0.5 * inner * std::cos(angle)));
+    const double hy        = (cy + (0.5 * inner * std::sin(angle)));
+    const int    sides     = (3 + (std::rand() % 6));
+    if (std::rand() % 2)
+    {
+      const double half = (0.7 * size);
+      points.push_back(Point(static_cast<float>(hx - half), static_cast<float>(hy - half)));
+      points.push_back(Point(static_cast<float>(hx + half), static_cast<float>(hy - half)));
+      points.push_back(Point(static_cast<float>(hx + half), static_cast<float>(hy + half)));
+      points.push_back(Point(static_cast<float>(hx - half), static_cast<float>(hy + half)));
+    }
+    else
+      for (int i = 0; i < sides; ++i)
+        points.push_back(Point(static_cast<float>(hx + (size * std::cos((turn * i) / sides))),
+                               static_cast<float>(hy + (size * std::sin((turn * i) / sides)))));
+    if (flipHoles)
+      std::reverse(points.begin() + holeFirst, points.end());
+    contourEnds.push_back(static_cast<int>(points.size()));
+  }
+}
+
+  /* Twice the signed area of the contour made of the points [first, end) of [points]. */
+static double ContourArea(const std::vector<Point> &points, int first, int end)
+{
+  double area = 0.0;
+  for (int i = first; i < end; ++i)
+  {
+    const Point &P = points[i];
+    const Point &Q = points[((i + 1) < end) ? (i + 1) : first];
+    area += ((static_cast<double>(P.x) * Q.y) - (static_cast<double>(Q.x) * P.y));
+  }
+  return area;
+}
+
+  /*
+   * Build the layout of a grid of [side] by [side] vertices, each square cut
+   * into two faces and outlined by its own four edges (so the inner sides
+   * are stored twice, once each way round), then add the junk an exporter
+   * might leave: a rotated repeat of every tenth face, a zero-length edge
+   * per row and a vertex no primitive uses per column. The vertices, edges
+   * and faces are then shuffled.
+   */
+static void JunkGrid(int side, MeshLayout &layout)
+{
+  layout.Clear();
+  for (int y = 0; y < side; ++y)
+    for (int x = 0; x < side; ++x)
+      layout.mVertices.push_back(Point(static_cast<float>(x), static_cast<float>(y)));
+  for (int y = 0; y < (side - 1); ++y)
+    for (int x = 0; x < (side - 1); ++x)
+    {
+      const int v = ((y * side) + x);
+      layout.mFaces.push_back(Mesh::Face(v, (v + 1), (v + side + 1)));
+      layout.mFaces.push_back(Mesh::Face(v, (v + side + 1), (v + side)));
+      layout.mEdges.push_back(Mesh::Edge(v, (v + 1)));
+      layout.mEdges.push_back(Mesh::Edge((v + 1), (v + side + 1)));
+      layout.mEdges.push_back(Mesh::Edge((v + side + 1), (v + side)));
+      layout.mEdges.push_back(Mesh::Edge((v + side), v));
+    }
+  layout.mOutline = MeshOutline(layout.mVertices, layout.mFaces);
+
+  const int faceCount = static_cast<int>(layout.mFaces.size());
+  for (int f = 0; f < faceCount; f += 10)
+  {
+    const Mesh::Face face = layout.mFaces[f];
+    layout.mFaces.push_back(Mesh::Face(face.index2, face.index3, face.index1));
+  }
+  for (int y = 0; y < side; ++y)
+    layout.mEdges.push_back(Mesh::Edge((y * side), (y * side)));
+  for (int x = 0; x < side; ++x)
+    layout.mVertices.push_back(Point((x + 0.5f), -1.0f));
+
+    /* Shuffle the vertices (renumbering everything using them), edges and faces. */
+  const int        vertCount = static_cast<int>(layout.mVertices.size());
+  std::vector<int> moved(vertCount);
+  for (int v = 0; v < vertCount; ++v)
+    moved[v] = v;
+  for (int v = (vertCount - 1); v > 0; --v)
+    std::swap(moved[v], moved[std::rand() % (v + 1)]);
+  std::vector<Point> verts(vertCount);
+  for (int v = 0; v < vertCount; ++v)
+    verts[moved[v]] = layout.mVertices[v];
+  layout.mVertices.swap(verts);
+  for (std::size_t f = 0; f < layout.mFaces.size(); ++f)
+    layout.mFaces[f] = Mesh::Face(moved[layout.mFaces[f].index1], moved[layout.mFaces[f].index2],
+                                  moved[layout.mFaces[f].index3]);
+  for (std::size_t e = 0; e < layout.mEdges.size(); ++e)
+    layout.mEdges[e] = Mesh::Edge(moved[layout.mEdges[e].index1], moved[layout.mEdges[e].index2]);
+  for (std::size_t i = 0; i < layout.mOutline.size(); ++i)
+    layout.mOutline[i] = moved[layout.mOutline[i]];
+  for (std::size_t f = (layout.mFaces.size() - 1); f > 0; --f)
+    std::swap(layout.mFaces[f], layout.mFaces[std::rand() % (f + 1)]);
+  for (std::size_t e = (layout.mEdges.size() - 1); e > 0; --e)
+    std::swap(layout.mEdges[e], layout.mEdges[std::rand() % (e + 1)]);
+
+  layout.mDimensions = Vector(static_cast<float>(side - 1), static_cast<float>(side));
+  layout.mCenter     = Point((0.5f * (side - 1)), (0.5f * (side - 2)));
+}
+
+  /*
+   * Transform the vertices of [mesh] by [transform] and walk its faces (as
+   * drawing it would), returning the sum of twice their areas.
+   */
+static double TransformAndWalk(MyMesh &mesh, const Affine &transform)
+{
+  mesh.Transform(transform);
+  const int faceCount = mesh.FaceCount();
+  double    area      = 0.0;
+  for (int f = 0; f < faceCount; ++f)
+  {
+    const Mesh::Face face = mesh.GetFace(f);
+    const Point     &P    = mesh.mTempVerts[face.index1];
+    const Point     &Q    = mesh.mTempVerts[face.index2];
+    const Point     &R    = mesh.mTempVerts[face.index3];
+    area += (((static_cast<double>(Q.x) - P.x) * (static_cast<double>(R.y) - P.y)) -
+             ((static_cast<double>(Q.y) - P.y) * (static_cast<double>(R.x) - P.x)));
+  }
+  return area;
+}
+
+  /* Print what OptimizeMeshLayout() dropped from a mesh and the memory it saved. */
+static void ReportMesh(const char *name, const MeshOptimizeReport &report)
+{
+  std::printf("  %-10s %9zu -> %9zu bytes (dropped %d vertices, %d edges, %d faces)\n",
+              name, report.mBytesBefore, report.mBytesAfter, report.mDroppedVertices,
+              report.mDroppedEdges, report.mDroppedFaces);
+}
+
+  /* Whether [section] was asked for on the command line (or none were). */
+static bool Wanted(int argc, char **argv, const char *section)
+{
+  if (argc < 2)
+    return true;
+  for (int i = 1; i < argc; ++i)
+    if (std::strcmp(argv[i], section) == 0)
+      return true;
+  return false;
+}
+
+
+/*############################################################################*/
+/*############################ Benchmark Sections ############################*/
+/*############################################################################*/
+
+/*!
+******************************************************************************
+  \fn void BenchSpans(Raster &raster)
+
+  \brief
+    Time the three span writers over whole scanlines, opaque and blended
+    (at an alpha of 160).
+
+  \param raster
+    The Raster object to write to.
+*******************************************************************************/
+static void BenchSpans(Raster &raster)
+{
+  const int   width   = raster.Width();
+  const int   height  = raster.Height();
+  const Fixed start[3] = { (Fixed(10) << gFracBits), (Fixed(20) << gFracBits),
+                           (Fixed(30) << gFracBits) };
+  const Fixed step[3]  = { (gFixedOne >> 4), (gFixedOne >> 5), (gFixedOne >> 6) };
+  std::vector<Raster::byte> rgb(3 * width, 200);
+
+  std::printf("spans (%dx%d, %d frames)\n", width, height, gFillFrames);
+  for (int blend = 0; blend < 2; ++blend)
+  {
+    raster.SetAlpha(blend ? 160 : gOpaqueAlpha);
+    raster.SetColor(10, 200, 30);
+
+    double seconds = BestRun([&]
+                     {
+                       for (int f = 0; f < gFillFrames; ++f)
+                         for (int y = 0; y < height; ++y)
+                         {
+                           raster.GotoPoint(0, y);
+                           raster.WriteSpan(width);
+                         }
+                     });
+    ReportPixels(blend ? "color span, blended" : "color span, opaque",
+                 (static_cast<double>(gFillFrames) * width * height), seconds);
+
+    seconds = BestRun([&]
+              {
+                for (int f = 0; f < gFillFrames; ++f)
+                  for (int y = 0; y < height; ++y)
+                  {
+                    raster.GotoPoint(0, y);
+                    raster.WriteShadedSpan(width, start, step);
+                  }
+              });
+    ReportPixels(blend ? "shaded span, blended" : "shaded span, opaque",
+                 (static_cast<double>(gFillFrames) * width * height), seconds);
+
+    seconds = BestRun([&]
+              {
+                for (int f = 0; f < gFillFrames; ++f)
+                  for (int y = 0; y < height; ++y)
+                  {
+                    raster.GotoPoint(0, y);
+                    raster.WritePixels(width, &rgb[0]);
+                  }
+              });
+    ReportPixels(blend ? "per-pixel span, blended" : "per-pixel span, opaque",
+                 (static_cast<double>(gFillFrames) * width * height), seconds);
+  }
+  raster.SetAlpha(gOpaqueAlpha);
+}
+
+/*!
+******************************************************************************
+  \fn void BenchFills(Raster &raster)
+
+  \brief
+    Time filling the whole frame buffer (as two triangles, two halves or
+    one sprite) flat, Gouraud shaded and textured.
+
+  \param raster
+    The Raster object to fill.
+*******************************************************************************/
+static void BenchFills(Raster &raster)
+{
+  const int   width  = raster.Width();
+  const int   height = raster.Height();
+  const float right  = static_cast<float>(width  - 1);
+  const float top    = static_cast<float>(height - 1);
+  const Point A(0.0f, 0.0f);
+  const Point B(right, 0.0f);
+  const Point C(right, top);
+  const Point D(0.0f, top);
+  const double pixels = (static_cast<double>(gFillFrames) * width * height);
+
+    /* A texture with no two neighbouring texels alike. */
+  std::vector<Color> texels(gTextureSize * gTextureSize);
+  for (int i = 0; i < (gTextureSize * gTextureSize); ++i)
+    texels[i] = Color((i & 255), ((i >> 8) & 255), ((i * 7) & 255));
+  Texture texture;
+  texture.Load(gTextureSize, gTextureSize, &texels[0]);
+
+  std::printf("fills (%dx%d, %d frames)\n", width, height, gFillFrames);
+
+    /*
+     * Half the screen wide and slanted across it, so that FillQuad walks its
+     * sides (rather than filling a rectangle) and two cover the screen.
+     */
+  const Point E(0.0f, 0.0f);
+  const Point F((0.5f * width), 0.0f);
+  const Point G(right, top);
+  const Point H((right - (0.5f * width)), top);
+  raster.SetColor(1, 2, 3);
+  double seconds = BestRun([&]
+                   {
+                     for (int f = 0; f < (2 * gFillFrames); ++f)
+                       FillQuad(raster, E, F, G, H);
+                   });
+  ReportPixels("flat parallelogram", pixels, seconds);
+
+    /*
+     * A grid of slanted tiles (all on screen) outlined in black, by filling
+     * each and drawing its sides over it (as RasterFaces() and RasterEdges()
+     * do) and by filling and outlining each in one pass.
+     */
+  const float tileH  = (top / gTileGrid);
+  const float slant  = (0.3f * tileH);
+  const float tileW  = ((right - (gTileGrid * slant)) / gTileGrid);
+  const Color black(0, 0, 0);
+  const Color orange(255, 127, 0);
+  std::vector<Point> tiles;
+  for (int j = 0; j < gTileGrid; ++j)
+    for (int i = 0; i < gTileGrid; ++i)
+    {
+      const Point corner(((i * tileW) + (j * slant)), (j * tileH));
+      tiles.push_back(corner);
+      tiles.push_back(Point((corner.x + tileW), corner.y));
+      tiles.push_back(Point((corner.x + tileW + slant), (corner.y + tileH)));
+      tiles.push_back(Point((corner.x + slant), (corner.y + tileH)));
+    }
+  const double tilePixels = (static_cast<double>(gFillFrames) * gTileGrid * gTileGrid * tileW * tileH);
+  seconds = BestRun([&]
+            {
+              for (int f = 0; f < gFillFrames; ++f)
+                for (std::size_t t = 0; t < tiles.size(); t += 4)
+                {
+                  raster.SetColor(orange.red, orange.grn, orange.blu);
+                  FillQuad(raster, tiles[t], tiles[t + 1], tiles[t + 2], tiles[t + 3]);
+                  raster.SetColor(black.red, black.grn, black.blu);
+                  for (int k = 0; k < 4; ++k)
+                    DrawLine(raster, tiles[t + k], tiles[t + ((k + 1) & 3)]);
+                }
+            });
+  ReportPixels("outlined tiles, fill + lines", tilePixels, seconds);
+  seconds = BestRun([&]
+            {
+              for (int f = 0; f < gFillFrames; ++f)
+                for (std::size_t t = 0; t < tiles.size(); t += 4)
+                  FillOutlinedQuad(raster, tiles[t], tiles[t + 1], tiles[t + 2], tiles[t + 3],
+                                   15u, 0.5f, orange, black);
+            });
+  ReportPixels("outlined tiles, one pass", tilePixels, seconds);
+
+  ColorPlane colors;
+  colors.Init(A, B, D, Color(255, 0, 0), Color(0, 255, 0), Color(0, 0, 255));
+  seconds = BestRun([&]
+            {
+              for (int f = 0; f < gFillFrames; ++f)
+              {
+                FillShadedTriangle(raster, A, B, D, colors);
+                FillShadedTriangle(raster, B, C, D, colors);
+              }
+            });
+  ReportPixels("Gouraud triangles", pixels, seconds);
+
+    /* Rotated and a little magnified, so neither axis lines up with texels. */
+  UVPlane uvs;
+  uvs.Init(A, B, D, Point(0.0f, 0.0f), Point(1.3f, 0.4f), Point(-0.4f, 1.3f));
+  for (int bilinear = 0; bilinear < 2; ++bilinear)
+  {
+    texture.SetBilinear(bilinear != 0);
+    seconds = BestRun([&]
+              {
+                for (int f = 0; f < gFillFrames; ++f)
+                {
+                  FillTexturedTriangle(raster, A, B, D, uvs, texture);
+                  FillTexturedTriangle(raster, B, C, D, uvs, texture);
+                }
+              });
+    ReportPixels(bilinear ? "textured triangles, bilinear" : "textured triangles, nearest",
+                 pixels, seconds);
+
+    seconds = BestRun([&]
+              {
+                for (int f = 0; f < gFillFrames; ++f)
+                  DrawSprite(raster, texture, -0.5f, -0.5f,
+                             static_cast<float>(width), static_cast<float>(height));
+              });
+    ReportPixels(bilinear ? "sprite, bilinear" : "sprite, nearest", pixels, seconds);
+  }
+}
+
+/*!
+******************************************************************************
+  \fn void BenchLines(Raster &raster)
+
+  \brief
+    Time drawing random lines of a few lengths, aliased and smooth.
+
+  \param raster
+    The Raster object to draw to.
+*******************************************************************************/
+static void BenchLines(Raster &raster)
+{
+  const int lengths[] = { 10, 40, 160 };
+  std::vector<Point> starts(gLineCount);
+  std::vector<Point> ends(gLineCount);
+
+  std::printf("lines (%dx%d, %d random lines)\n", raster.Width(), raster.Height(), gLineCount);
+  std::printf("  %-8s %12s %12s\n", "length", "aliased", "smooth");
+  for (unsigned l = 0; l < (sizeof(lengths) / sizeof(lengths[0])); ++l)
+  {
+      /* Lines of the length in every direction, wholly on screen. */
+    const int length = lengths[l];
+    std::srand(1);
+    for (int i = 0; i < gLineCount; ++i)
+    {
+      const float x     = static_cast<float>(length + (std::rand() % (raster.Width()  - (2 * length) - 2)));
+      const float y     = static_cast<float>(length + (std::rand() % (raster.Height() - (2 * length) - 2)));
+      const float angle = (static_cast<float>(std::rand() % 6283) / 1000.0f);
+      starts[i] = Point(x, y);
+      ends[i]   = Point((x + (length * std::cos(angle))), (y + (length * std::sin(angle))));
+    }
+
+    double seconds[2];
+    for (int smooth = 0; smooth < 2; ++smooth)
+      seconds[smooth] = BestRun([&]
+                        {
+                          for (int i = 0; i < gLineCount; ++i)
+                          {
+                            raster.SetColor((i & 255), ((i >> 3) & 255), 200);
+                            if (smooth)
+                              DrawSmoothLine(raster, starts[i], ends[i]);
+                            else
+                              DrawLine(raster, starts[i], ends[i]);
+                          }
+                        });
+    std::printf("  %-8d %10.2f M %10.2f M\n", length,
+                ((gLineCount / seconds[0]) / 1.0e6), ((gLineCount / seconds[1]) / 1.0e6));
+  }
+}
+
+
+/*!
+******************************************************************************
+  \fn void BenchShapes(Raster &raster)
+
+  \brief
+    Time filling and outlining random ellipses, circles and arcs (three
+    quarters of a turn) with the Ellipse primitives, and the same shapes
+    tessellated (into a segment per 4 pixels of the circle's circumference,
+    from 16 to [gMaxSegments]) and drawn as a FillTriangle fan and a
+    DrawLine polyline.
+
+  \param raster
+    The Raster object to draw to.
+*******************************************************************************/
+static void BenchShapes(Raster &raster)
+{
+  const int        radii[] = { 8, 32, 128 };
+  const float      turn    = 6.2831853f;
+  const DirtyRect  screen(0, 0, raster.Width(), raster.Height());
+  std::vector<int> xs;
+  std::vector<int> ys;
+
+  std::printf("shapes (%dx%d, us per shape)\n", raster.Width(), raster.Height());
+  std::printf("  %-6s %-14s %10s %12s\n", "radius", "shape", "primitive", "tessellated");
+  for (unsigned r = 0; r < (sizeof(radii) / sizeof(radii[0])); ++r)
+  {
+      /* Shapes of the radius wholly on screen (ellipses are half as tall). */
+    const int radius   = radii[r];
+    const int count    = ((radius < 64) ? gShapeCount : (gShapeCount / 10));
+    const int segments = std::max(16, std::min(gMaxSegments, static_cast<int>((turn * radius) / 4.0f)));
+    std::srand(1);
+    xs.resize(count);
+    ys.resize(count);
+    for (int i = 0; i < count; ++i)
+    {
+      xs[i] = (radius + (std::rand() % (raster.Width()  - (2 * radius))));
+      ys[i] = (radius + (std::rand() % (raster.Height() - (2 * radius))));
+    }
+
+      /* Each shape: its radii, the part of the turn it spans, and whether it is filled. */
+    struct Shape
+    {
+      const char *mName;
+      int         mRy;
+      float       mTurn;
+      bool        mFill;
+    };
+    const Shape shapes[] = { { "circle fill",   radius,       1.0f,  true  },
+                             { "circle edge",   radius,       1.0f,  false },
+                             { "ellipse fill",  (radius / 2), 1.0f,  true  },
+                             { "ellipse edge",  (radius / 2), 1.0f,  false },
+                             { "arc fill",      radius,       0.75f, true  },
+                             { "arc edge",      radius,       0.75f, false } };
+    for (unsigned s = 0; s < (sizeof(shapes) / sizeof(shapes[0])); ++s)
+    {
+      const Shape &shape  = shapes[s];
+      const float  end    = (shape.mTurn * turn);
+      const bool   whole  = (shape.mTurn == 1.0f);
+      const int    pieces = static_cast<int>(std::ceil(segments * shape.mTurn));
+      std::vector<Point> points;
+
+      const double primitive = BestRun([&]
+                               {
+                                 for (int i = 0; i < count; ++i)
+                                 {
+                                   raster.SetColor((i & 255), 100, 200);
+                                   if (whole && shape.mFill)
+                                     FillEllipse(raster, xs[i], ys[i], radius, shape.mRy, screen);
+                                   else if (whole)
+                                     DrawEllipse(raster, xs[i], ys[i], radius, shape.mRy, screen);
+                                   else if (shape.mFill)
+                                     FillArc(raster, xs[i], ys[i], radius, shape.mRy, 0.0f, end, screen);
+                                   else
+                                     DrawArc(raster, xs[i], ys[i], radius, shape.mRy, 0.0f, end, screen);
+                                 }
+                               });
+      const double tessellated = BestRun([&]
+                                 {
+                                   for (int i = 0; i < count; ++i)
+                                   {
+                                     const Point C(static_cast<float>(xs[i]), static_cast<float>(ys[i]));
+                                     raster.SetColor((i & 255), 100, 200);
+                                     TessellateArc(C, static_cast<float>(radius),
+                                                   static_cast<float>(shape.mRy), 0.0f, end,
+                                                   pieces, points);
+                                     for (int k = 0; k < pieces; ++k)
+                                       if (shape.mFill)
+                                         FillTriangle(raster, C, points[k], points[k + 1]);
+                                       else
+                                         DrawLine(raster, points[k], points[k + 1]);
+                                   }
+                                 });
+      std::printf("  %-6d %-14s %10.2f %12.2f\n", radius, shape.mName,
+                  ((primitive / count) * 1.0e6), ((tessellated / count) * 1.0e6));
+    }
+  }
+}
+
+
+/*!
+******************************************************************************
+  \fn void BenchPaths(Raster &raster)
+
+  \brief
+    Time flattening and drawing a unit circle made of 4 cubic Beziers,
+    centered on the screen and scaled by a range of radii, at the default
+    tolerance, and drawing the same circle cut into [gFixedSteps] lines per
+    curve instead.
+
+  \param raster
+    The Raster object to draw to.
+*******************************************************************************/
+static void BenchPaths(Raster &raster)
+{
+  const float radii[] = { 0.5f, 2.0f, 8.0f, 32.0f, 128.0f, 512.0f };
+    /* How far a circle's cubic control points lie from its ends (per unit radius). */
+  const float kappa   = 0.5522847f;
+
+  Path circle;
+  circle.MoveTo(Point(1.0f, 0.0f));
+  circle.CubicTo(Point(1.0f, kappa),  Point(kappa, 1.0f),   Point(0.0f, 1.0f));
+  circle.CubicTo(Point(-kappa, 1.0f), Point(-1.0f, kappa),  Point(-1.0f, 0.0f));
+  circle.CubicTo(Point(-1.0f, -kappa), Point(-kappa, -1.0f), Point(0.0f, -1.0f));
+  circle.CubicTo(Point(kappa, -1.0f), Point(1.0f, -kappa),  Point(1.0f, 0.0f));
+  circle.Close();
+
+    /* The same circle, each curve cut into [gFixedSteps] lines. */
+  Path fixed;
+  fixed.MoveTo(circle.Points()[0]);
+  for (int c = 0; c < 4; ++c)
+  {
+    const Point *pCurve = &circle.Points()[3 * c];
+    for (int k = 1; k <= gFixedSteps; ++k)
+    {
+      const float t = (static_cast<float>(k) / gFixedSteps);
+      const float u = (1.0f - t);
+      const float w[4] = { (u * u * u), (3.0f * u * u * t), (3.0f * u * t * t), (t * t * t) };
+      fixed.LineTo(Point(((w[0] * pCurve[0].x) + (w[1] * pCurve[1].x) +
+                          (w[2] * pCurve[2].x) + (w[3] * pCurve[3].x)),
+                         ((w[0] * pCurve[0].y) + (w[1] * pCurve[1].y) +
+                          (w[2] * pCurve[2].y) + (w[3] * pCurve[3].y))));
+    }
+  }
+  fixed.Close();
+
+  const Vector center((0.5f * raster.Width()), (0.5f * raster.Height()));
+  FlatPath     flat;
+  std::printf("paths (%dx%d, a circle of 4 cubics, %.2f px tolerance, us per path)\n",
+              raster.Width(), raster.Height(), gPathTolerance);
+  std::printf("  %-8s %8s %10s %10s %12s\n", "radius", "lines", "flatten", "draw", "draw fixed");
+  for (unsigned r = 0; r < (sizeof(radii) / sizeof(radii[0])); ++r)
+  {
+    const Affine worldToDev = (Trans(center) * Scale(radii[r]));
+
+      /* The last curve ends on the first point, so closing it adds no line. */
+    flat.Clear();
+    FlattenPath(circle, worldToDev, gPathTolerance, flat);
+    const int lines = (static_cast<int>(flat.mPoints.size()) - 1);
+
+    const double flatten = BestRun([&]
+                           {
+                             for (int i = 0; i < gPathCount; ++i)
+                             {
+                               flat.Clear();
+                               FlattenPath(circle, worldToDev, gPathTolerance, flat);
+                             }
+                           });
+    const double draw = BestRun([&]
+                        {
+                          for (int i = 0; i < gPathCount; ++i)
+                          {
+                            raster.SetColor((i & 255), 200, 100);
+                            DrawPath(raster, circle, worldToDev);
+                          }
+                        });
+    const double drawFixed = BestRun([&]
+                             {
+                               for (int i = 0; i < gPathCount; ++i)
+                               {
+                                 raster.SetColor((i & 255), 200, 100);
+                                 DrawPath(raster, fixed, worldToDev);
+                               }
+                             });
+    std::printf("  %-8.1f %8d %10.2f %10.2f %12.2f\n", radii[r], lines,
+                ((flatten / gPathCount) * 1.0e6), ((draw / gPathCount) * 1.0e6),
+                ((drawFixed / gPathCount) * 1.0e6));
+  }
+}
+
+
+/*!
+******************************************************************************
+  \fn void BenchPolygons(void)
+
+  \brief
+    Check BuildMeshLayout against random star polygons, counting those for
+    which it fails, for which the faces are not n + 2h - 2 (for n points
+    and h holes), do not add up to the polygon's area or are not all
+    counterclockwise, for which the outline is not MeshOutline() of the
+    faces, and the pixels where filling the faces (with FillTriangle)
+    differs from filling the polygon even-odd (with FillPolygon). Then time
+    building a batch of polygons with BuildMeshLayouts, with and without a
+    TaskPool.
+*******************************************************************************/
+static void BenchPolygons(void)
+{
+    /* The polygons are drawn to a frame buffer of their own, cleared for each. */
+  const int                 width  = 320;
+  const int                 height = 240;
+  std::vector<Raster::byte> pixels(3 * width * height);
+  std::vector<Raster::byte> expected;
+  Raster                    raster(&pixels[0], width, height, (3 * width));
+  const DirtyRect           screen(0, 0, width, height);
+
+  std::vector<Point> points;
+  std::vector<int>   contourEnds;
+  MeshLayout         layout;
+  int failed     = 0;
+  int wrongCount = 0;
+  int wrongArea  = 0;
+  int clockwise  = 0;
+  int wrongLine  = 0;
+  int wrongPixel = 0;
+  int litPixels  = 0;
+  std::srand(3);
+  for (int t = 0; t < gCheckedPolygons; ++t)
+  {
+    const int n     = (3 + (std::rand() % 40));
+    const int holes = ((12 <= n) ? (std::rand() % 4) : 0);
+    points.clear();
+    contourEnds.clear();
+    StarPolygon(points, contourEnds, RandomIn(60.0, 260.0), RandomIn(60.0, 180.0),
+                RandomIn(20.0, 70.0), n, holes, ((std::rand() % 2) != 0), ((std::rand() % 2) != 0));
+    if (!BuildMeshLayout(&points[0], &contourEnds[0], static_cast<int>(contourEnds.size()), layout))
+    {
+      ++failed;
+      continue;
+    }
+    if (static_cast<int>(layout.mFaces.size()) != (static_cast<int>(points.size()) + (2 * holes) - 2))
+      ++wrongCount;
+
+    double area = std::fabs(ContourArea(points, 0, contourEnds[0]));
+    for (std::size_t c = 1; c < contourEnds.size(); ++c)
+      area -= std::fabs(ContourArea(points, contourEnds[c - 1], contourEnds[c]));
+    double faceArea = 0.0;
+    bool   turned   = false;
+    for (std::size_t f = 0; f < layout.mFaces.size(); ++f)
+    {
+      const Mesh::Face &face = layout.mFaces[f];
+      const Point      &P    = layout.mVertices[face.index1];
+      const Point      &Q    = layout.mVertices[face.index2];
+      const Point      &R    = layout.mVertices[face.index3];
+      const double      a    = (((static_cast<double>(Q.x) - P.x) * (static_cast<double>(R.y) - P.y)) -
+                                ((static_cast<double>(Q.y) - P.y) * (static_cast<double>(R.x) - P.x)));
+      turned   |= (a < 0.0);
+      faceArea += a;
+    }
+    if (std::fabs(faceArea - area) > (1e-3 * area))
+      ++wrongArea;
+    if (turned)
+      ++clockwise;
+
+    const std::vector<int> outline = MeshOutline(layout.mVertices, layout.mFaces);
+    std::multiset<std::pair<int, int> > fromFaces;
+    std::multiset<std::pair<int, int> > built;
+    for (std::size_t i = 0; i < outline.size(); i += 2)
+      fromFaces.insert(std::make_pair(outline[i], outline[i + 1]));
+    for (std::size_t i = 0; i < layout.mOutline.size(); i += 2)
+      built.insert(std::make_pair(layout.mOutline[i], layout.mOutline[i + 1]));
+    if (fromFaces != built)
+      ++wrongLine;
+
+    raster.SetColor(255, 255, 255);
+    std::fill(pixels.begin(), pixels.end(), 0);
+    FillPolygon(raster, &points[0], &contourEnds[0], static_cast<int>(contourEnds.size()),
+                eEvenOdd, screen);
+    expected = pixels;
+    std::fill(pixels.begin(), pixels.end(), 0);
+    for (std::size_t f = 0; f < layout.mFaces.size(); ++f)
+      FillTriangle(raster, layout.mVertices[layout.mFaces[f].index1],
+                           layout.mVertices[layout.mFaces[f].index2],
+                           layout.mVertices[layout.mFaces[f].index3]);
+    for (std::size_t i = 0; i < pixels.size(); i += 3)
+    {
+      wrongPixel += (pixels[i] != expected[i]);
+      litPixels  += (expected[i] != 0);
+    }
+  }
+  std::printf("polygons (%d random star polygons checked)\n", gCheckedPolygons);
+  std::printf("  failed %d, wrong face count %d, wrong area %d, clockwise faces %d, "
+              "wrong outline %d\n", failed, wrongCount, wrongArea, clockwise, wrongLine);
+  std::printf("  faces filled differ from the polygon filled on %d of %d lit pixels\n",
+              wrongPixel, litPixels);
+
+    /* A batch of polygons of 8 to 63 points and up to 2 holes, all built at once. */
+  std::vector<int> polygonEnds;
+  points.clear();
+  contourEnds.clear();
+  std::srand(5);
+  for (int p = 0; p < gBatchPolygons; ++p)
+  {
+    StarPolygon(points, contourEnds, 0.0, 0.0, 50.0, (8 + (std::rand() % 56)),
+                (std::rand() % 3), false, true);
+    polygonEnds.push_back(static_cast<int>(contourEnds.size()));
+  }
+  std::vector<MeshLayout> layouts(gBatchPolygons);
+  std::printf("  batch of %d polygons (%d points), ms per batch:\n",
+              gBatchPolygons, static_cast<int>(points.size()));
+
+  const int threads[] = { 0, 4 };
+  int       count     = 0;
+  double    seconds   = BestRun([&]
+                        {
+                          count = BuildMeshLayouts(&points[0], &contourEnds[0], &polygonEnds[0],
+                                                   gBatchPolygons, &layouts[0]);
+                        });
+  std::printf("    %-22s %8.2f (%d built)\n", "serial", (seconds * 1.0e3), count);
+  for (unsigned t = 0; t < (sizeof(threads) / sizeof(threads[0])); ++t)
+  {
+    TaskPool pool(threads[t]);
+    seconds = BestRun([&]
+              {
+                count = BuildMeshLayouts(&points[0], &contourEnds[0], &polygonEnds[0],
+                                         gBatchPolygons, &layouts[0], &pool);
+              });
+    char name[32];
+    std::snprintf(name, sizeof(name), "TaskPool, %d threads", pool.ThreadCount());
+    std::printf("    %-22s %8.2f (%d built)\n", name, (seconds * 1.0e3), count);
+  }
+}
+
+/*!
+******************************************************************************
+  \fn void BenchMeshes(void)
+
+  \brief
+    Report the memory OptimizeMeshLayout and PackMeshLayout save on the
+    CustomMesh (as InitFrame() draws it) and on a shuffled grid with junk
+    primitives. Then time optimizing the grid, and transforming it and
+    walking its faces as given and once optimized and packed.
+*******************************************************************************/
+static void BenchMeshes(void)
+{
+  std::printf("meshes\n");
+  MeshLayout         layout;
+  MeshOptimizeReport report;
+  CustomMesh         custom;
+  CopyMeshLayout(custom, layout);
+  OptimizeMeshLayout(layout, &report);
+  ReportMesh("CustomMesh", report);
+
+  MeshLayout given;
+  std::srand(7);
+  JunkGrid(gGridSide, given);
+  double seconds = BestRun([&]
+                   {
+                     layout = given;
+                     OptimizeMeshLayout(layout, &report);
+                   });
+  PackedMeshLayout packed;
+  PackMeshLayout(layout, packed);
+  char name[32];
+  std::snprintf(name, sizeof(name), "grid %dx%d", gGridSide, gGridSide);
+  ReportMesh(name, report);
+  std::printf("  %-28s %8.2f ms\n", "optimize", (seconds * 1.0e3));
+
+  LayoutMesh   before(given);
+  PackedMesh   after(packed);
+  const Affine transform = (Rot(0.3f) * Scale(1.5f));
+  double       area      = 0.0;
+  seconds = BestRun([&] { area += TransformAndWalk(before, transform); });
+  std::printf("  %-28s %8.2f ms (%d faces)\n", "transform + walk, as given",
+              (seconds * 1.0e3), before.FaceCount());
+  seconds = BestRun([&] { area += TransformAndWalk(after, transform); });
+  std::printf("  %-28s %8.2f ms (%d faces)\n", "transform + walk, packed",
+              (seconds * 1.0e3), after.FaceCount());
+  std::printf("  (face area %.0f)\n", area);
+}
+
+
+/*############################################################################*/
+/*############################### Entry Point ################################*/
+/*############################################################################*/
+
+int main(int argc, char **argv)
+{
+  std::vector<Raster::byte> pixels(3 * gBenchWidth * gBenchHeight, 100);
+  Raster raster(&pixels[0], gBenchWidth, gBenchHeight, (3 * gBenchWidth));
+
+  if (Wanted(argc, argv, "spans"))
+    BenchSpans(raster);
+  if (Wanted(argc, argv, "fills"))
+    BenchFills(raster);
+  if (Wanted(argc, argv, "lines"))
+    BenchLines(raster);
+  if (Wanted(argc, argv, "shapes"))
+    BenchShapes(raster);
+  if (Wanted(argc, argv, "paths"))
+    BenchPaths(raster);
+  if (Wanted(argc, argv, "polygons"))
+    BenchPolygons();
+  if (Wanted(argc, argv, "meshes"))
+    BenchMeshes();
+
+    /* Keep the writes from being optimized away. */
+  unsigned checksum = 0;
+  for (std::size_t i = 0; i < pixels.size(); i += 997)
+    checksum += pixels[i];
+  std::printf("checksum %u\n", checksum);
+  return 0;
+}
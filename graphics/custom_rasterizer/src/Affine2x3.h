@@ -0,0 +1,110 @@
+/*!
+*****************************************************************************
+\file   Affine2x3.h
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the definition of the Affine2x3 struct, a compact form of
+  an Affine transformation used when many transformations are stored at once.
+*******************************************************************************/
+#ifndef AFFINE2X3_H
+#define AFFINE2X3_H
+
+#include "Affine.h"
+
+
+/*!
+******************************************************************************
+  \struct Affine2x3
+
+  \brief
+    Stores only the top two rows of an Affine matrix (the bottom row of an
+    affine transformation is always [0, 0, 1]). This halves the size of a
+    transformation (24 vs 36 bytes) and lets points be transformed without
+    touching their homogeneous coordinate.
+*******************************************************************************/
+struct Affine2x3
+{
+    /* The top two rows of the matrix: [m00 m01 m02] and [m10 m11 m12]. */
+  float m00, m01, m02;
+  float m10, m11, m12;
+
+    /* Default constructor. Initializes to the identity. */
+  Affine2x3(void)
+    : m00(1.0f), m01(0.0f), m02(0.0f),
+      m10(0.0f), m11(1.0f), m12(0.0f) { ; }
+    /* Conversion constructor. Drops the bottom row of [A]. */
+  explicit Affine2x3(const Affine &A)
+    : m00(A[0][0]), m01(A[0][1]), m02(A[0][2]),
+      m10(A[1][0]), m11(A[1][1]), m12(A[1][2]) { ; }
+
+    /* Convert back to a full Affine matrix. */
+  Affine ToAffine(void) const
+  {
+    Affine result;
+    result[0] = Hcoords(m00, m01, m02);
+    result[1] = Hcoords(m10, m11, m12);
+    return result;
+  }
+    /* Transform the x/y-components of [in] into the x/y-components of [out]. */
+  void Apply(const Point &in, Point &out) const
+  {
+    float x = in.x;
+    float y = in.y;
+    out.x = ((m00 * x) + (m01 * y) + m02);
+    out.y = ((m10 * x) + (m11 * y) + m12);
+  }
+    /*
+     * Transform [count] points from [pIn] into [pOut]. The homogeneous
+     * coordinate of each output point is left as is (i.e. 1 for points).
+     */
+  void Apply(const Point *pIn, Point *pOut, int count) const
+  {
+    for (int i = 0; i < count; ++i)
+      Apply(pIn[i], pOut[i]);
+  }
+};
+
+/*!
+******************************************************************************
+  \fn Affine2x3 operator* (const Affine2x3 &A, const Affine2x3 &B)
+
+  \brief
+    Calculates a single matrix that represents the transformation of [B]
+    followed by [A].
+*******************************************************************************/
+inline
+Affine2x3 operator* (const Affine2x3 &A, const Affine2x3 &B)
+{
+  Affine2x3 result;
+  result.m00 = ((A.m00 * B.m00) + (A.m01 * B.m10));
+  result.m01 = ((A.m00 * B.m01) + (A.m01 * B.m11));
+  result.m02 = ((A.m00 * B.m02) + (A.m01 * B.m12) + A.m02);
+  result.m10 = ((A.m10 * B.m00) + (A.m11 * B.m10));
+  result.m11 = ((A.m10 * B.m01) + (A.m11 * B.m11));
+  result.m12 = ((A.m10 * B.m02) + (A.m11 * B.m12) + A.m12);
+  return result;
+}
+
+/*!
+******************************************************************************
+  \fn bool operator== (const Affine2x3 &A, const Affine2x3 &B)
+
+  \brief
+    Whether [A] and [B] are exactly the same transformation.
+*******************************************************************************/
+inline
+bool operator== (const Affine2x3 &A, const Affine2x3 &B)
+{
+  return ((A.m00 == B.m00) && (A.m01 == B.m01) && (A.m02 == B.m02) &&
+          (A.m10 == B.m10) && (A.m11 == B.m11) && (A.m12 == B.m12));
+}
+
+
+#endif
+
@@ -0,0 +1,191 @@
+/*!
+*****************************************************************************
+\file   AlphaBlend.cpp
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the implementation of the alpha blending span kernels.
+
+  Every channel of every pixel is blended the same way, so the kernels work
+  on the bytes of a span rather than on its pixels, a block of 16 pixels
+  (48 bytes) at a time: each block is a fixed-length loop of independent
+  16-bit multiply-adds, which the compiler turns into SIMD instructions on
+  its own (no intrinsics, so the kernels build anywhere). Source pixels are
+  copied into a local block first, so the compiler knows they cannot overlap
+  the pixels being blended. Every product and sum fits in 16 bits, and each
+  result is rounded once, to the nearest integer.
+*******************************************************************************/
+#include "AlphaBlend.h"
+#include <cstring>
+
+
+/*############################################################################*/
+/*############################# Global Constants #############################*/
+/*############################################################################*/
+
+  /* Number of pixels blended per block. */
+static const int gBlockPixels = 16;
+  /* Number of bytes blended per block. */
+static const int gBlockBytes  = (3 * gBlockPixels);
+
+
+/*############################################################################*/
+/*########################## Local Helper Functions ##########################*/
+/*############################################################################*/
+
+  /*
+   * Divide [x] (within [0, 255 * 255]) by 255, rounding to the nearest
+   * integer, in 16-bit arithmetic (see Div255()).
+   */
+inline
+unsigned char Div255Short(unsigned short x)
+{
+  x = static_cast<unsigned short>(x + 128);
+  return static_cast<unsigned char>((x + (x >> 8)) >> 8);
+}
+
+
+/*############################################################################*/
+/*######################### Function Implementation ##########################*/
+/*############################################################################*/
+
+/*!
+******************************************************************************
+  \fn void BlendColorSpan(unsigned char *pDst, int count, unsigned char red,
+                          unsigned char grn, unsigned char blu, int alpha)
+
+  \brief
+    Draw a color over a span of pixels. The color is premultiplied by its
+    alpha once, into a block's worth of bytes, leaving a single multiply per
+    byte of the span.
+
+  \param pDst
+    The first pixel of the span.
+
+  \param count
+    The number of pixels in the span.
+
+  \param red, grn, blu
+    The color to draw.
+
+  \param alpha
+    The opacity of the color (within [0, 255]).
+*******************************************************************************/
+void BlendColorSpan(unsigned char *pDst,
+                    int            count,
+                    unsigned char  red,
+                    unsigned char  grn,
+                    unsigned char  blu,
+                    int            alpha)
+{
+  const unsigned short inv = static_cast<unsigned short>(gOpaqueAlpha - alpha);
+  unsigned short       src[gBlockBytes];
+  for (int i = 0; i < gBlockBytes; i += 3)
+  {
+    src[i]     = static_cast<unsigned short>(red * alpha);
+    src[i + 1] = static_cast<unsigned short>(grn * alpha);
+    src[i + 2] = static_cast<unsigned short>(blu * alpha);
+  }
+
+  const int bytes = (3 * count);
+  int       i     = 0;
+  for (/* i = 0 */; (i + gBlockBytes) <= bytes; i += gBlockBytes)
+  {
+    unsigned char *pBlock = (pDst + i);
+    for (int j = 0; j < gBlockBytes; ++j)
+      pBlock[j] = Div255Short(static_cast<unsigned short>(src[j] + (pBlock[j] * inv)));
+  }
+  for (int j = 0; i < bytes; ++i, ++j)
+    pDst[i] = Div255Short(static_cast<unsigned short>(src[j] + (pDst[i] * inv)));
+}
+
+/*!
+******************************************************************************
+  \fn void BlendPixelSpan(unsigned char *pDst, const unsigned char *pSrc,
+                          int count, int alpha)
+
+  \brief
+    Draw a span of pixels over another with a single alpha.
+
+  \param pDst
+    The first pixel of the span drawn over.
+
+  \param pSrc
+    The first pixel of the span drawn.
+
+  \param count
+    The number of pixels in the spans.
+
+  \param alpha
+    The opacity of the pixels drawn (within [0, 255]).
+*******************************************************************************/
+void BlendPixelSpan(      unsigned char *pDst,
+                    const unsigned char *pSrc,
+                          int            count,
+                          int            alpha)
+{
+  const unsigned short a     = static_cast<unsigned short>(alpha);
+  const unsigned short inv   = static_cast<unsigned short>(gOpaqueAlpha - alpha);
+  const int            bytes = (3 * count);
+  int                  i     = 0;
+  unsigned char        src[gBlockBytes];
+  for (/* i = 0 */; (i + gBlockBytes) <= bytes; i += gBlockBytes)
+  {
+    unsigned char *pBlock = (pDst + i);
+    std::memcpy(src, (pSrc + i), gBlockBytes);
+    for (int j = 0; j < gBlockBytes; ++j)
+      pBlock[j] = Div255Short(static_cast<unsigned short>((src[j] * a) + (pBlock[j] * inv)));
+  }
+  for (/* i = i */; i < bytes; ++i)
+    pDst[i] = Div255Short(static_cast<unsigned short>((pSrc[i] * a) + (pDst[i] * inv)));
+}
+
+/*!
+******************************************************************************
+  \fn void BlendPremultipliedSpan(unsigned char *pDst,
+                                  const unsigned char *pSrc, int count,
+                                  int alpha)
+
+  \brief
+    Draw a span of premultiplied pixels over another: only the pixels drawn
+    over need scaling.
+
+  \param pDst
+    The first pixel of the span drawn over.
+
+  \param pSrc
+    The first pixel of the span drawn, its channels already multiplied by
+    [alpha] / 255.
+
+  \param count
+    The number of pixels in the spans.
+
+  \param alpha
+    The opacity of the pixels drawn (within [0, 255]).
+*******************************************************************************/
+void BlendPremultipliedSpan(      unsigned char *pDst,
+                            const unsigned char *pSrc,
+                                  int            count,
+                                  int            alpha)
+{
+  const unsigned short inv   = static_cast<unsigned short>(gOpaqueAlpha - alpha);
+  const int            bytes = (3 * count);
+  int                  i     = 0;
+  unsigned char        src[gBlockBytes];
+  for (/* i = 0 */; (i + gBlockBytes) <= bytes; i += gBlockBytes)
+  {
+    unsigned char *pBlock = (pDst + i);
+    std::memcpy(src, (pSrc + i), gBlockBytes);
+    for (int j = 0; j < gBlockBytes; ++j)
+      pBlock[j] = static_cast<unsigned char>(src[j] +
+                                             Div255Short(static_cast<unsigned short>(pBlock[j] * inv)));
+  }
+  for (/* i = i */; i < bytes; ++i)
+    pDst[i] = static_cast<unsigned char>(pSrc[i] +
+                                         Div255Short(static_cast<unsigned short>(pDst[i] * inv)));
+}
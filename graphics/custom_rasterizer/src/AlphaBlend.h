@@ -0,0 +1,73 @@
+/*!
+*****************************************************************************
+\file   AlphaBlend.h
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the prototypes of the span kernels that draw over the
+  frame buffer with source-over alpha blending, along with the rounding
+  division they share.
+*******************************************************************************/
+#ifndef ALPHABLEND_H
+#define ALPHABLEND_H
+
+
+/*############################################################################*/
+/*############################# Global Constants #############################*/
+/*############################################################################*/
+
+  /* The alpha of fully opaque colors. */
+static const int gOpaqueAlpha = 255;
+
+
+/*############################################################################*/
+/*############################# Helper Functions #############################*/
+/*############################################################################*/
+
+  /* Divide [x] (within [0, 255 * 255]) by 255, rounding to the nearest integer. */
+inline
+int Div255(int x)
+{
+  x += 128;
+  return ((x + (x >> 8)) >> 8);
+}
+
+
+/*############################################################################*/
+/*########################### Function Prototypes ############################*/
+/*############################################################################*/
+
+  /*
+   * Draw the color ([red], [grn], [blu]) with [alpha] (within [0, 255]) over
+   * the [count] pixels at [pDst] (three bytes per pixel: red, green, blue).
+   */
+void BlendColorSpan(unsigned char *pDst,
+                    int            count,
+                    unsigned char  red,
+                    unsigned char  grn,
+                    unsigned char  blu,
+                    int            alpha);
+  /*
+   * Draw the [count] pixels at [pSrc] with [alpha] (within [0, 255]) over the
+   * ones at [pDst].
+   */
+void BlendPixelSpan(      unsigned char *pDst,
+                    const unsigned char *pSrc,
+                          int            count,
+                          int            alpha);
+  /*
+   * Draw the [count] pixels at [pSrc], already multiplied by [alpha] (within
+   * [0, 255]), over the ones at [pDst].
+   */
+void BlendPremultipliedSpan(      unsigned char *pDst,
+                            const unsigned char *pSrc,
+                                  int            count,
+                                  int            alpha);
+
+
+#endif
@@ -0,0 +1,295 @@
+/*!
+*****************************************************************************
+\file   Background.cpp
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the implementation of the procedural checkerboard
+  background.
+
+  Every scanline of the screen is mapped back into the grid's (col, row)
+  coordinates. Along a scanline both coordinates change by a constant amount
+  per pixel, so they are stepped in 32.32 fixed point. The tile under the
+  pixel only changes when one of the coordinates crosses an integer, so
+  rather than testing each pixel the distance to the next crossing is
+  computed directly and the whole run of pixels up to it is written at once.
+*******************************************************************************/
+#include "Background.h"
+#include "FixedPoint.h"
+#include "RasterUtilities.h"
+#include "ScreenClip.h"
+#include <cmath>
+
+
+/*############################################################################*/
+/*########################## Local Helper Functions ##########################*/
+/*############################################################################*/
+
+  /*
+   * Get the number of steps before the coordinate [value], moving by [step]
+   * per pixel, leaves the integer cell it is currently in.
+   */
+static Fixed StepsToCrossing(Fixed value, Fixed step)
+{
+  Fixed cell = (value >> gFracBits) << gFracBits;
+
+  if (step > 0)
+    return CeilDiv((cell + gFixedOne - value), step);
+  if (step < 0)
+    return (FloorDiv((value - cell), -step) + 1);
+    /* The coordinate never changes. */
+  return gFixedOne;
+}
+
+  /* Write [count] pixels of [color] starting at pixel (x, y). */
+static void WriteRun(Raster &raster, int x, int y, int count, const Color &color)
+{
+  raster.SetColor(color.red, color.grn, color.blu);
+  raster.GotoPoint(x, y);
+  raster.WriteSpan(count);
+}
+
+
+/*############################################################################*/
+/*######################### Function Implementation ##########################*/
+/*############################################################################*/
+
+/*!
+******************************************************************************
+  \fn void DrawCheckerboard(Raster &raster, const Affine &worldToDev,
+                            const CheckerGrid &grid)
+
+  \brief
+    Draw the checkerboard described by [grid] to every pixel of the Raster
+    object's pixel buffer, as seen through [worldToDev].
+
+  \param raster
+    The Raster object that the checkerboard will be drawn to.
+
+  \param worldToDev
+    The world-to-device transformation of the current camera.
+
+  \param grid
+    The checkerboard to draw.
+*******************************************************************************/
+void DrawCheckerboard(Raster &raster, const Affine &worldToDev, const CheckerGrid &grid)
+{
+  const Affine devToWorld = Inverse(worldToDev);
+
+  for (int y = 0; y < raster.Height(); ++y)
+    DrawCheckerboardRow(raster, devToWorld, grid, y, 0, raster.Width());
+
+  if (grid.mBorders)
+    DrawCheckerBorders(raster, worldToDev, grid);
+}
+
+/*!
+******************************************************************************
+  \fn void DrawCheckerboardRow(Raster &raster, const Affine &devToWorld,
+                               const CheckerGrid &grid, int y,
+                               int xMin, int xMax)
+
+  \brief
+    Draw the pixels [xMin, xMax) of scanline [y] of the checkerboard (without
+    the tile borders).
+
+  \param raster
+    The Raster object that the checkerboard will be drawn to.
+
+  \param devToWorld
+    The device-to-world transformation of the current camera.
+
+  \param grid
+    The checkerboard to draw.
+
+  \param y
+    The scanline to draw.
+
+  \param xMin
+    The first pixel of the scanline to draw.
+
+  \param xMax
+    One past the last pixel of the scanline to draw.
+*******************************************************************************/
+void DrawCheckerboardRow(      Raster      &raster,
+                         const Affine      &devToWorld,
+                         const CheckerGrid &grid,
+                               int          y,
+                               int          xMin,
+                               int          xMax)
+{
+  if (xMax <= xMin)
+    return;
+
+    /*
+     * The grid coordinates of pixel (x, y) are
+     *   col = (world x - corner x) and row = (corner y - world y),
+     * so along the scanline they start at (col0, row0) for x = 0 and change by
+     * (dCol, dRow) per pixel.
+     */
+  const double fy   = static_cast<double>(y);
+  const Fixed  col0 = ToFixed((devToWorld[0][1] * fy) + devToWorld[0][2] - grid.mCorner.x);
+  const Fixed  row0 = ToFixed(grid.mCorner.y - ((devToWorld[1][1] * fy) + devToWorld[1][2]));
+  const Fixed  dCol = ToFixed( devToWorld[0][0]);
+  const Fixed  dRow = ToFixed(-devToWorld[1][0]);
+  const Fixed  size = (static_cast<Fixed>(grid.mCount) * gFixedOne);
+
+    /* Find the pixels of the span that land inside of the grid. */
+  Fixed inMin = xMin;
+  Fixed inMax = (xMax - 1);
+  ClampToRange(col0, dCol, size, inMin, inMax);
+  ClampToRange(row0, dRow, size, inMin, inMax);
+
+    /* The grid misses this span entirely. */
+  if (inMax < inMin)
+  {
+    WriteRun(raster, xMin, y, (xMax - xMin), grid.mClearColor);
+    return;
+  }
+
+    /* Clear the parts of the span on either side of the grid. */
+  WriteRun(raster, xMin, y, static_cast<int>(inMin - xMin), grid.mClearColor);
+  WriteRun(raster, static_cast<int>(inMax + 1), y,
+           static_cast<int>(xMax - 1 - inMax), grid.mClearColor);
+
+    /* Walk the grid, one run of same-colored pixels at a time. */
+  Fixed col = (col0 + (dCol * inMin));
+  Fixed row = (row0 + (dRow * inMin));
+  for (Fixed x = inMin; x <= inMax; )
+  {
+    Fixed run = std::min(std::min(StepsToCrossing(col, dCol),
+                                  StepsToCrossing(row, dRow)),
+                         (inMax - x + 1));
+    int   parity = static_cast<int>(((col >> gFracBits) + (row >> gFracBits)) & 1);
+
+    WriteRun(raster, static_cast<int>(x), y, static_cast<int>(run), grid.mColors[parity]);
+
+    x   += run;
+    col += (dCol * run);
+    row += (dRow * run);
+  }
+}
+
+/*!
+******************************************************************************
+  \fn int ClearOutsideGrid(Raster &raster, const Affine &worldToDev,
+                           const CheckerGrid &grid)
+
+  \brief
+    Clear the pixels of each scanline that lie outside of (or within about a
+    pixel of the edge of) [grid], so that the tiles drawn afterwards do not
+    have to be drawn over a fully cleared screen. The margin makes up for the
+    tiles' own fill rule, which may leave the pixels right along the edge of
+    the grid (or of the screen) uncovered.
+
+  \param raster
+    The Raster object that will be cleared.
+
+  \param worldToDev
+    The world-to-device transformation of the current camera.
+
+  \param grid
+    The checkerboard that will be drawn over the cleared screen.
+
+  \return
+    The number of pixels that were cleared.
+*******************************************************************************/
+int ClearOutsideGrid(Raster &raster, const Affine &worldToDev, const CheckerGrid &grid)
+{
+  const Affine devToWorld = Inverse(worldToDev);
+  const int    width      = raster.Width();
+  const Fixed  dCol       = ToFixed( devToWorld[0][0]);
+  const Fixed  dRow       = ToFixed(-devToWorld[1][0]);
+
+    /*
+     * Inset the grid by the (world-space) length of a pixel's diagonal, the
+     * furthest a pixel center can be from a pixel that the grid covers.
+     */
+  const double pixel  = std::sqrt((devToWorld[0][0] * devToWorld[0][0]) +
+                                  (devToWorld[1][0] * devToWorld[1][0]) +
+                                  (devToWorld[0][1] * devToWorld[0][1]) +
+                                  (devToWorld[1][1] * devToWorld[1][1]));
+  const Fixed  margin = ToFixed(pixel);
+  const Fixed  size   = ((static_cast<Fixed>(grid.mCount) * gFixedOne) - (2 * margin));
+  int          cleared = 0;
+
+  for (int y = 0; y < raster.Height(); ++y)
+  {
+    const double fy    = static_cast<double>(y);
+    const Fixed  col0  = ToFixed((devToWorld[0][1] * fy) + devToWorld[0][2] - grid.mCorner.x);
+    const Fixed  row0  = ToFixed(grid.mCorner.y - ((devToWorld[1][1] * fy) + devToWorld[1][2]));
+    Fixed        inMin = 1;
+    Fixed        inMax = (width - 2);
+
+      /* Faces clipped to the screen may also leave its outermost pixels bare. */
+    if ((size > 0) && (0 < y) && (y < (raster.Height() - 1)))
+    {
+      ClampToRange((col0 - margin), dCol, size, inMin, inMax);
+      ClampToRange((row0 - margin), dRow, size, inMin, inMax);
+    }
+    else
+      inMax = (inMin - 1);
+
+      /* The grid is not sure to cover any of this scanline. */
+    if (inMax < inMin)
+    {
+      WriteRun(raster, 0, y, width, grid.mClearColor);
+      cleared += width;
+      continue;
+    }
+
+    WriteRun(raster, 0, y, static_cast<int>(inMin), grid.mClearColor);
+    WriteRun(raster, static_cast<int>(inMax + 1), y,
+             static_cast<int>(width - 1 - inMax), grid.mClearColor);
+    cleared += (width - static_cast<int>(inMax - inMin + 1));
+  }
+
+  return cleared;
+}
+
+/*!
+******************************************************************************
+  \fn void DrawCheckerBorders(Raster &raster, const Affine &worldToDev,
+                              const CheckerGrid &grid)
+
+  \brief
+    Draw the outline of every tile of [grid]. Since neighboring tiles share
+    their edges, the outlines are drawn as (count + 1) horizontal and
+    (count + 1) vertical lines spanning the whole grid.
+
+  \param raster
+    The Raster object that the borders will be drawn to.
+
+  \param worldToDev
+    The world-to-device transformation of the current camera.
+
+  \param grid
+    The checkerboard whose tiles are outlined.
+*******************************************************************************/
+void DrawCheckerBorders(Raster &raster, const Affine &worldToDev, const CheckerGrid &grid)
+{
+  Clip &screenClip = ScreenClip(raster.Width(), raster.Height());
+  const float left   = grid.mCorner.x;
+  const float top    = grid.mCorner.y;
+  const float right  = (left + grid.mCount);
+  const float bottom = (top  - grid.mCount);
+
+  raster.SetColor(grid.mBorderColor.red, grid.mBorderColor.grn, grid.mBorderColor.blu);
+  for (int i = 0; i <= grid.mCount; ++i)
+  {
+    Point P = (worldToDev * Point((left + i),    top));
+    Point Q = (worldToDev * Point((left + i), bottom));
+    if (screenClip(P, Q))
+      DrawLine(raster, P, Q);
+
+    P = (worldToDev * Point( left, (top - i)));
+    Q = (worldToDev * Point(right, (top - i)));
+    if (screenClip(P, Q))
+      DrawLine(raster, P, Q);
+  }
+}
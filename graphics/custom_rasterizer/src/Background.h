@@ -0,0 +1,92 @@
+/*!
+*****************************************************************************
+\file   Background.h
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the definition of the CheckerGrid struct and the
+  prototype of DrawCheckerboard, which draws the checkered background
+  procedurally instead of as individual tiles.
+*******************************************************************************/
+#ifndef BACKGROUND_H
+#define BACKGROUND_H
+
+#include "Affine.h"
+#include "Color.h"
+#include "Raster.h"
+
+
+/*!
+******************************************************************************
+  \struct CheckerGrid
+
+  \brief
+    Describes a square grid of 1x1 world-space tiles whose colors alternate in
+    a checkered pattern. Tile (row, col) covers the world-space square whose
+    top-left corner is (mCorner.x + col, mCorner.y - row), and is drawn in
+    mColors[(row + col) % 2].
+*******************************************************************************/
+struct CheckerGrid
+{
+    /* The world-space top-left corner of the grid. */
+  Point mCorner;
+    /* The number of tiles along each side of the grid. */
+  int   mCount;
+    /* The two alternating tile colors. */
+  Color mColors[2];
+    /* The color of everything outside of the grid. */
+  Color mClearColor;
+    /* Whether to outline the tiles, and in which color. */
+  bool  mBorders;
+  Color mBorderColor;
+
+    /* Default constructor. */
+  CheckerGrid(void)
+    : mCorner(), mCount(0), mClearColor(255, 255, 255),
+      mBorders(true), mBorderColor() { ; }
+};
+
+
+/*############################################################################*/
+/*########################### Function Prototypes ############################*/
+/*############################################################################*/
+
+  /*
+   * Draw [grid] to every pixel of the Raster object's pixel buffer as seen
+   * through [worldToDev]. Each scanline is mapped back to world space through
+   * the inverse of [worldToDev] and walked in fixed point, so the cost depends
+   * on the number of pixels (plus the number of tile boundaries crossed), not
+   * on the number of tiles. Pixels outside of the grid are set to the grid's
+   * clear color, so the screen does not need to be cleared beforehand.
+   */
+void DrawCheckerboard(Raster &raster, const Affine &worldToDev, const CheckerGrid &grid);
+  /*
+   * Draw only the scanline [y] from pixel [xMin] up to (but not including)
+   * [xMax] of the checkerboard, given the device-to-world transformation
+   * (the inverse of the world-to-device transformation).
+   */
+void DrawCheckerboardRow(      Raster      &raster,
+                         const Affine      &devToWorld,
+                         const CheckerGrid &grid,
+                               int          y,
+                               int          xMin,
+                               int          xMax);
+  /*
+   * Set every pixel that the tiles of [grid] (as seen through [worldToDev])
+   * may not cover to the grid's clear color, leaving the pixels they are sure
+   * to cover untouched. Drawing the tiles afterwards then produces the same
+   * frame as clearing the whole screen first. Returns the number of pixels
+   * that were cleared.
+   */
+int ClearOutsideGrid(Raster &raster, const Affine &worldToDev, const CheckerGrid &grid);
+  /* Draw the outlines of every tile in [grid] as seen through [worldToDev]. */
+void DrawCheckerBorders(Raster &raster, const Affine &worldToDev, const CheckerGrid &grid);
+
+
+#endif
+
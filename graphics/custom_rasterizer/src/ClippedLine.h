@@ -0,0 +1,42 @@
+/*!
+*****************************************************************************
+\file   ClippedLine.h
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the prototype of DrawClippedLine, which draws the part
+  of a line that falls inside a rectangle of pixels.
+*******************************************************************************/
+#ifndef CLIPPEDLINE_H
+#define CLIPPEDLINE_H
+
+#include "Affine.h"
+#include "Raster.h"
+
+
+/*############################################################################*/
+/*########################### Function Prototypes ############################*/
+/*############################################################################*/
+
+  /*
+   * Draw the pixels of the line segment from [pt_P] to [pt_Q] (in screen
+   * coordinates, already clipped to the screen) that lie in the pixel
+   * rectangle [x0, x1) x [y0, y1). The line is stepped exactly as DrawLine
+   * steps it and only the writes outside the rectangle are skipped, so the
+   * pixels drawn are the ones DrawLine would draw there.
+   */
+void DrawClippedLine(      Raster &raster,
+                     const Point  &pt_P,
+                     const Point  &pt_Q,
+                           int     x0,
+                           int     y0,
+                           int     x1,
+                           int     y1);
+
+
+#endif
@@ -0,0 +1,41 @@
+/*!
+*****************************************************************************
+\file   Color.h
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the definition of the Color struct shared by the
+  rasterization helpers.
+*******************************************************************************/
+#ifndef COLOR_H
+#define COLOR_H
+
+#include "Raster.h"
+
+
+  /* Short-hand typedef to make code cleaner. */
+typedef Raster::byte Cval;
+
+/*!
+******************************************************************************
+  \struct Color
+
+  \brief
+    Small wrapper class with default constructor for easily managing an RGB
+    value.
+*******************************************************************************/
+struct Color
+{
+  Cval red, grn, blu;
+
+  Color(Cval r = 0, Cval g = 0, Cval b = 0) : red(r), grn(g), blu(b) { ; }
+};
+
+
+#endif
+
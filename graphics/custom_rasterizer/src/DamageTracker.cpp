@@ -0,0 +1,133 @@
+/*!
+*****************************************************************************
+\file   DamageTracker.cpp
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the implementation of the DamageTracker class' methods.
+*******************************************************************************/
+#include "DamageTracker.h"
+
+
+/*############################################################################*/
+/*############################## Public Defines ##############################*/
+/*############################################################################*/
+
+const int DamageTracker::scmMaxItems;
+
+
+/*############################################################################*/
+/*############################## Public Methods ##############################*/
+/*############################################################################*/
+
+  /* Default Constructor. */
+DamageTracker::DamageTracker(void)
+  : mPrevBounds(),
+    mRects(),
+    mWidth(0),
+    mHeight(0),
+    mValid(false),
+    mFullRedraw(true) { ; }
+
+  /* Whether the last frame tracked has to be drawn in full. */
+bool DamageTracker::IsFullRedraw(void) const
+{ return mFullRedraw; }
+
+  /* Get the dirty rectangles of the last frame tracked. */
+const std::vector<DirtyRect> &DamageTracker::DirtyRects(void) const
+{ return mRects; }
+
+  /* Get the number of pixels covered by the dirty rectangles. */
+int DamageTracker::DirtyPixels(void) const
+{
+  int pixels = 0;
+  for (auto iter = mRects.begin(); iter != mRects.end(); ++iter)
+    pixels += iter->Area();
+
+  return pixels;
+}
+
+  /* Work out the dirty rectangles of a frame. */
+bool DamageTracker::Track(const std::vector<DirtyRect> &bounds, int width, int height)
+{
+  const int itemCount = static_cast<int>(bounds.size());
+
+  mFullRedraw = (!mValid                                             ||
+                 (width     != mWidth)                               ||
+                 (height    != mHeight)                              ||
+                 (itemCount != static_cast<int>(mPrevBounds.size())) ||
+                 (itemCount >  scmMaxItems));
+  mRects.clear();
+
+  if (!mFullRedraw)
+  {
+      /* Each item dirties where it was and where it is now. */
+    for (int i = 0; i < itemCount; ++i)
+    {
+      DirtyRect rect = bounds[i];
+      rect.Merge(mPrevBounds[i]);
+      if (!rect.IsEmpty())
+        mRects.push_back(rect);
+    }
+    MergeOverlaps();
+
+      /* Past half the screen, one full pass is cheaper than many small ones. */
+    mFullRedraw = ((2 * DirtyPixels()) > (width * height));
+  }
+  if (mFullRedraw)
+    mRects.assign(1, DirtyRect(0, 0, width, height));
+
+  mPrevBounds = bounds;
+  mWidth      = width;
+  mHeight     = height;
+  mValid      = true;
+
+  return !mFullRedraw;
+}
+
+  /* Force the next frame to be drawn in full. */
+void DamageTracker::Invalidate(void)
+{ mValid = false; }
+
+
+/*############################################################################*/
+/*############################# Private Methods ##############################*/
+/*############################################################################*/
+
+  /* Merge overlapping dirty rectangles for as long as it pays off. */
+void DamageTracker::MergeOverlaps(void)
+{
+    /*
+     * Two overlapping rectangles are merged when their bounding rectangle
+     * covers no more pixels than drawing them separately would. Growing a
+     * rectangle can make it worth merging with one that was already checked,
+     * so keep sweeping until a sweep merges nothing.
+     */
+  bool changed = true;
+  while (changed)
+  {
+    changed = false;
+    for (std::size_t i = 0; i < mRects.size(); ++i)
+      for (std::size_t j = (i + 1); j < mRects.size(); )
+      {
+        DirtyRect merged = mRects[i];
+        merged.Merge(mRects[j]);
+        if (mRects[i].Overlaps(mRects[j]) &&
+            (merged.Area() <= (mRects[i].Area() + mRects[j].Area())))
+        {
+          mRects[i] = merged;
+          mRects[j] = mRects.back();
+          mRects.pop_back();
+          j       = (i + 1);
+          changed = true;
+        }
+        else
+          ++j;
+      }
+  }
+}
@@ -0,0 +1,152 @@
+/*!
+*****************************************************************************
+\file   DamageTracker.h
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the definitions of the DirtyRect struct and the
+  DamageTracker class, which work out which regions of the screen changed
+  between two frames so that only those regions need to be drawn again.
+*******************************************************************************/
+#ifndef DAMAGETRACKER_H
+#define DAMAGETRACKER_H
+
+#include <vector>
+
+
+/*!
+******************************************************************************
+  \struct DirtyRect
+
+  \brief
+    A rectangle of pixels, [mX0, mX1) x [mY0, mY1), in device coordinates.
+*******************************************************************************/
+struct DirtyRect
+{
+  int mX0, mY0;
+  int mX1, mY1;
+
+    /* Default constructor. Initializes to an empty rectangle. */
+  DirtyRect(int x0 = 0, int y0 = 0, int x1 = 0, int y1 = 0)
+    : mX0(x0), mY0(y0), mX1(x1), mY1(y1) { ; }
+
+    /* Whether the rectangle covers no pixels. */
+  bool IsEmpty(void) const
+  { return ((mX1 <= mX0) || (mY1 <= mY0)); }
+    /* Number of pixels covered by the rectangle. */
+  int Area(void) const
+  { return (IsEmpty() ? 0 : ((mX1 - mX0) * (mY1 - mY0))); }
+    /* Whether the two rectangles share any pixel. */
+  bool Overlaps(const DirtyRect &other) const
+  {
+    return ((mX0 < other.mX1) && (other.mX0 < mX1) &&
+            (mY0 < other.mY1) && (other.mY0 < mY1));
+  }
+    /* Grow to the bounding rectangle of this rectangle and [other]. */
+  void Merge(const DirtyRect &other)
+  {
+    if (other.IsEmpty())
+      return;
+    if (IsEmpty())
+    {
+      *this = other;
+      return;
+    }
+    mX0 = ((other.mX0 < mX0) ? other.mX0 : mX0);
+    mY0 = ((other.mY0 < mY0) ? other.mY0 : mY0);
+    mX1 = ((other.mX1 > mX1) ? other.mX1 : mX1);
+    mY1 = ((other.mY1 > mY1) ? other.mY1 : mY1);
+  }
+};
+
+
+/*!
+******************************************************************************
+  \class DamageTracker
+
+  \brief
+    Given the screen bounds of every drawn item (e.g. each dynamic object) on
+    each frame, works out the dirty rectangles of the frame: the union of each
+    item's bounds on the previous and current frames. Overlapping rectangles
+    are merged whenever their bounding rectangle is no bigger than the two
+    of them, so clusters of items end up in one rectangle without spreading
+    over the empty space between distant ones. A frame is brought up to date
+    by restoring the background of each dirty rectangle, then drawing every
+    item that touches it again (in their usual order) clipped to it. Doing
+    so is idempotent, so any rectangles left overlapping are still correct.
+
+    When a frame cannot be drawn incrementally (the tracker was invalidated,
+    the items changed, or too much of the screen is dirty for it to pay off),
+    the whole screen is reported as a single dirty rectangle.
+*******************************************************************************/
+class DamageTracker
+{
+/*############################################################################*/
+/*############################## Public Defines ##############################*/
+/*############################################################################*/
+public:
+    /* Item count above which merging the rectangles costs more than it saves. */
+  static const int scmMaxItems = 512;
+
+
+/*############################################################################*/
+/*############################## Public Methods ##############################*/
+/*############################################################################*/
+public:
+
+  /******************************* Constructors *******************************/
+    /* Default Constructor. */
+  DamageTracker(void);
+
+  /********************************* Getters **********************************/
+    /* Whether the last frame tracked has to be drawn in full. */
+  bool IsFullRedraw(void) const;
+    /* Get the dirty rectangles of the last frame tracked. */
+  const std::vector<DirtyRect> &DirtyRects(void) const;
+    /* Get the number of pixels covered by the dirty rectangles. */
+  int DirtyPixels(void) const;
+
+  /********************************* Mutators *********************************/
+    /*
+     * Work out the dirty rectangles of a [width] x [height] frame, given the
+     * bounds of each item on this frame. Returns whether the frame can be
+     * drawn incrementally.
+     */
+  bool Track(const std::vector<DirtyRect> &bounds, int width, int height);
+    /* Force the next frame to be drawn in full (e.g. when the view changed). */
+  void Invalidate(void);
+
+
+/*############################################################################*/
+/*############################# Private Methods ##############################*/
+/*############################################################################*/
+private:
+    /* Merge overlapping dirty rectangles for as long as it pays off. */
+  void MergeOverlaps(void);
+
+
+/*############################################################################*/
+/*############################# Private Members ##############################*/
+/*############################################################################*/
+private:
+    /* The bounds of each item on the previous frame. */
+  std::vector<DirtyRect> mPrevBounds;
+    /* The dirty rectangles of the last frame tracked. */
+  std::vector<DirtyRect> mRects;
+    /* The dimensions of the last frame tracked. */
+  int                    mWidth;
+  int                    mHeight;
+    /* Whether the previous frame's bounds can be trusted. */
+  bool                   mValid;
+    /* Whether the last frame tracked has to be drawn in full. */
+  bool                   mFullRedraw;
+};
+
+
+#endif
+
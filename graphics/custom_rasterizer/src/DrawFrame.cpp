@@ -13,13 +13,41 @@
   a pixel buffer in software.
 *******************************************************************************/
 #include "Affine.h"
+#include "Affine2x3.h"
+#include "Background.h"
 #include "Camera.h"
 #include "Clip.h"
+#include "Color.h"
+#include "DamageTracker.h"
 #include "DrawFrame.h"
+#include "DrawOrder.h"
+#include "FrameOptions.h"
+#include "GouraudFill.h"
+#include "Instancing.h"
+#include "LayerCache.h"
+#include "MeshBuilder.h"
+#include "MeshLod.h"
+#include "MsaaFill.h"
 #include "MyMesh.h"
+#include "PolygonFill.h"
+#include "QuadFill.h"
 #include "RasterUtilities.h"
 #include "Raster.h"
+#include "Reprojection.h"
+#include "SceneGraph.h"
+#include "SampleBuffer.h"
+#include "SceneRandom.h"
+#include "ScreenClip.h"
+#include "SmoothLine.h"
+#include "SpanBuffer.h"
+#include "Stroke.h"
+#include "TaskPool.h"
+#include "TextureFill.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <ctime>
+#include <memory>
 
 
 /*############################################################################*/
@@ -39,6 +67,14 @@ float frand(float a = 0.0f, float b = 1.0f)
 int irand(float a = 0.0f, float b = 1.0f)
 { return static_cast<int>(frand(a, b)); }
 
+  /* Clamp an opacity option to the range of an alpha. */
+static Cval ToAlpha(int opacity)
+{ return static_cast<Cval>(std::min(std::max(opacity, 0), gOpaqueAlpha)); }
+
+  /* The style of an outline option when stroked (NULL when drawn as lines). */
+static const StrokeStyle *WideStroke(const StrokeStyle &style)
+{ return ((1.0f < style.mWidth) ? &style : NULL); }
+
 
 /*############################################################################*/
 /*############################# Global Constants #############################*/
@@ -50,30 +86,30 @@ static const float PI       = (4.0f * atan(1.0f));
 static const float gRotRate = (2 * (PI / frand(5.0f,  8.0f)));
   /* World origin. */
 static const Point gOrigin(0.0f, 0.0f);
-  /* Number of dynamic objects to generate. */
-static const int gDynamicObjCount = 50;
+  /*
+   * Minimum number of dynamic objects handed to each thread of the parallel
+   * update/transform stage (smaller scenes run on fewer threads).
+   */
+static const int gMinObjectsPerThread = 256;
+  /* Radius (in world units) within which grouped objects surround their parent. */
+static const float gClusterRadius = 1.5f;
+  /* Number of pieces each of the dynamic camera's square's edges is tracked as. */
+static const int gEdgePieces = 8;
+
 
 /*############################################################################*/
-/*############################ Class Definitions #############################*/
+/*############################### Scene Graph ################################*/
 /*############################################################################*/
 
-  /* Short-hand typedef to make code cleaner. */
-typedef Raster::byte Cval;
-
-/*!
-******************************************************************************
-  \struct Color
-
-  \brief
-    Small wrapper class with default constructor for easily managing an RGB
-    value.
-*******************************************************************************/
-struct Color
-{
-  Cval red, grn, blu;
+  /*
+   * The transformation hierarchy of the scene. Declared ahead of the classes
+   * below since they keep their transformations in it.
+   */
+static SceneGraph gSceneGraph;
 
-  Color(Cval r = 0, Cval g = 0, Cval b = 0) : red(r), grn(g), blu(b) { ; }
-};
+/*############################################################################*/
+/*############################ Class Definitions #############################*/
+/*############################################################################*/
 
 /*!
 ******************************************************************************
@@ -87,8 +123,11 @@ struct Object
 {
     /* Store the color of the faces for this object. */
   Color mFaceColor;
+    /* Store the opacity of the faces for this object (see Raster::SetAlpha()). */
+  Cval  mFaceAlpha;
     /* Default constructor. */
-  Object(Color faceColor = Color(255, 255, 255)) : mFaceColor(faceColor) { ; }
+  Object(Color faceColor = Color(255, 255, 255))
+    : mFaceColor(faceColor), mFaceAlpha(gOpaqueAlpha) { ; }
     /* Virtual destructor. */
   virtual ~Object(void) { ; }
     /* Pure virtual transform method used to update the object. */
@@ -122,6 +161,16 @@ struct Tile : public Object
   { ; }
     /* Virtual destructor. */
   virtual ~Tile(void) { ; }
+    /*
+     * Late "constructor" used to initialize Tiles that were bulk allocated
+     * (e.g. by std::vector<...>::resize) and reserve their vertex storage.
+     */
+  void Init(const Vector &pos, const Color &faceColor)
+  {
+    mFaceColor     = faceColor;
+    mOjbectToWorld = (Trans(pos) * Trans(gOrigin - mMesh.Center()));
+    mMesh.mTempVerts.reserve(mMesh.VertexCount());
+  }
     /*
      * Transform the baseline vertices according to this Tile's
      * position in space with relation to the current viewing camera.
@@ -134,64 +183,68 @@ struct Tile : public Object
 
 /*!
 ******************************************************************************
-  \struct DynamicObj : Object
+  \struct DynamicObj
 
   \brief
-    Derived Object specialized for rotating objects displaced from the
-    origin made up of a CustomMesh.
+    The motion of a rotating object displaced from the origin. Every
+    DynamicObj is drawn as an instance of the shared CustomMesh (packed, see
+    gDynamicMesh), so it only holds what moves it and its scene graph node.
 *******************************************************************************/
-struct DynamicObj : public Object
+struct DynamicObj
 {
-    /* Represent each DynamicObj by a CustomMesh. */
-  CustomMesh mMesh;
     /*
-     * This object will need to rotate so store each constant transformation
-     * on either side of the rotation transformation in the transformation
-     * pipeline separately.
+     * This object will need to rotate so store the constant transformation
+     * before the rotation in the transformation pipeline separately.
      */
   Affine     mObjectToOrigin;
-  Affine     mOriginToPosition;
   Vector     mPosition;
   Vector     mVelocity;
 
     /* Store the rate of rotation for this object. */
   float      mRotationRate;
+    /* The scene graph node whose local transformation this object drives. */
+  SceneGraph::NodeId mNode;
     /* Default constructor. */
-  DynamicObj(const Vector &pos       = Vector(0.0f, 0.0f),
-                   float   scale     = 1.0f,
-                   float   rotRate   = 0.0f,
-             const Vector &velocity  = Vector(0.0f, 0.0f),
-             const Color  &faceColor = Color(255, 255, 255))
-    : Object(faceColor),
-      mMesh(),
-      mObjectToOrigin(Scale(scale) * Trans(gOrigin - mMesh.Center())),
-      mOriginToPosition(Trans(Vector(pos.x, pos.y))),
-      mPosition(pos),
-      mVelocity(velocity),
-      mRotationRate(rotRate)
+  DynamicObj(void)
+    : mObjectToOrigin(Scale(1.0f)),
+      mPosition(0.0f, 0.0f),
+      mVelocity(0.0f, 0.0f),
+      mRotationRate(0.0f),
+      mNode(SceneGraph::scmNoParent)
   { ; }
-    /* Virtual destructor. */
-  virtual ~DynamicObj(void) { ; }
+    /*
+     * Late "constructor" used to initialize DynamicObjs that were bulk
+     * allocated (e.g. by std::vector<...>::resize), centering the mesh they
+     * are drawn with (whose center is [meshCenter]) on the origin.
+     */
+  void Init(const Point  &meshCenter,
+            const Vector &pos,
+                  float   scale,
+                  float   rotRate,
+            const Vector &velocity)
+  {
+    mObjectToOrigin = (Scale(scale) * Trans(gOrigin - meshCenter));
+    mPosition       = pos;
+    mVelocity       = velocity;
+    mRotationRate   = rotRate;
+  }
 
     /*
-     * Transform the baseline vertices according to this DynamicObj's
-     * position in space with relation to the current viewing camera
-     * while updating its current rotation.
+     * Advance this DynamicObj's position by one step and return its
+     * object-to-world transformation at [curnTime] (i.e. the local
+     * transformation of its scene graph node).
      */
-  virtual void Transform(const Affine &worldToDev, float curnTime)
+  Affine Update(float curnTime)
   {
     mPosition = (mVelocity + mPosition);
 
-    mOriginToPosition = Trans(Vector(mPosition.x, mPosition.y));
+    const Affine originToPosition = Trans(mPosition);
 
-    mMesh.Transform(worldToDev                        *
-                    mOriginToPosition                 *
-                    Rot(mRotationRate *
-                        static_cast<float>(curnTime)) *
-                    mObjectToOrigin);
+    return (originToPosition                  *
+            Rot(mRotationRate *
+                static_cast<float>(curnTime)) *
+            mObjectToOrigin);
   }
-    /* Return a reference to this DynamicObj's mesh. */
-  virtual MyMesh &GetMesh(void) { return mMesh; }
 };
 
 /*!
@@ -206,53 +259,59 @@ struct CamObj : public Object
 {
     /* Represent each DynamicObj by a SquareMesh. */
   SquareMesh mMesh;
+    /* The accumulated rotation of the dynamic camera. */
+  Affine     mRotation;
     /*
-     * This object will need to rotate so store each constant transformation
-     * on either side of the rotation transformation in the transformation
-     * pipeline separately.
+     * The camera is represented by two scene graph nodes: a "rig" node that
+     * carries the camera's position and orientation (and changes every
+     * frame), and the square under it that scales the SquareMesh to the
+     * camera's dimensions (which never changes after initialization).
      */
-  Affine     mObjectToOrigin;
-  Affine     mOriginToWorld;
+  SceneGraph::NodeId mRigNode;
+  SceneGraph::NodeId mSquareNode;
     /* Store the rate of rotation for this object. */
   float      mRotationRate;
     /* Default constructor. */
-  CamObj(const Vector &pos       = Vector(0.0f, 0.0f),
-         const Vector &scale     = Vector(1.0f, 1.0f),
-               float   rotRate   = 0.0f,
-         const Color  &faceColor = Color(255, 255, 255))
+  CamObj(float rotRate = 0.0f, const Color &faceColor = Color(255, 255, 255))
     : Object(faceColor),
       mMesh(),
-      mObjectToOrigin(Scale(scale.x, scale.y) * Trans(gOrigin - mMesh.Center())),
-      mOriginToWorld(Trans(Vector(pos.x, pos.y))),
+      mRotation(Rot(0.0f)),
+      mRigNode(SceneGraph::scmNoParent),
+      mSquareNode(SceneGraph::scmNoParent),
       mRotationRate(rotRate)
   { ; }
     /* Virtual destructor. */
   virtual ~CamObj(void) { ; }
     /*
-     * Initialize the scale of this object according to the given
-     * scaling which corresponds to the dimensions of the dynamic camera.
+     * Create this object's scene graph nodes, scaling the square according
+     * to the given scaling which corresponds to the dimensions of the
+     * dynamic camera.
      */
   void InitScale(const Vector &scale)
-  { mObjectToOrigin = (Scale(scale.x, scale.y) * mObjectToOrigin); }
+  {
+    mRotation   = Rot(0.0f);
+    mRigNode    = gSceneGraph.AddNode(SceneGraph::scmNoParent);
+    mSquareNode = gSceneGraph.AddNode(mRigNode,
+                                      Affine2x3(Scale(scale.x, scale.y) *
+                                                Trans(gOrigin - mMesh.Center())));
+  }
     /*
-     * Update the the transformation matrices responsible for transforming
-     * the SquareMesh to the dynamic camera's current position and orientation.
+     * Update the the camera rig's node to the dynamic camera's current
+     * position and orientation. The square under it is left untouched.
      */
   void Update(const Point &newCenter, const Affine &rotate)
   {
-      /*
-       * Update the object's orientation separate from its world position so
-       * the update to the position does not affect subsequent transformations.
-       */
-    mObjectToOrigin = (rotate * mObjectToOrigin);
-    mOriginToWorld  = (Trans(Vector(newCenter.x, newCenter.y)) * mObjectToOrigin);
+    mRotation = (rotate * mRotation);
+    gSceneGraph.SetLocal(mRigNode,
+                         Affine2x3(Trans(Vector(newCenter.x, newCenter.y)) *
+                                   mRotation));
   }
     /*
-     * Transform the baseline vertices according to the updated transformation
-     * matrix according to the dynamic camera's current position and orientation.
+     * Transform the baseline vertices according to the square's world
+     * transformation (as of the last update of the scene graph).
      */
   virtual void Transform(const Affine &worldToDev, float curnTime)
-  { mMesh.Transform(worldToDev * mOriginToWorld); }
+  { mMesh.Transform(worldToDev * gSceneGraph.GetWorld(mSquareNode).ToAffine()); }
     /* Return a reference to this SquareMesh's mesh. */
   virtual MyMesh &GetMesh(void) { return mMesh; }
 };
@@ -467,9 +526,18 @@ const float CamManager::scmDynamicSize  =  5.0f;
 /*######################## Local Function Prototypes #########################*/
 /*############################################################################*/
 
+static void      DrawBackground(Raster &raster, const Affine &worldToDev);
+static void      DrawDirtyRects(Raster &raster, Object *pCamObj);
+static void      DrawFrontToBack(Raster &raster, const Affine &worldToDev, Object *pCamObj);
+static DirtyRect LineBounds    (const Point &P, const Point &Q, int width, int height,
+                                float reach);
 static void Rasterize  (Raster &raster, Object &object);
 static void RasterFaces(Raster &raster, Object &object);
-static void RasterEdges(Raster &raster, Object &object, Color color = Color());
+static void FillFaces  (Raster &raster, Object &object);
+static bool FindQuad(MyMesh &mesh, int corners[4]);
+static bool RasterOutlined(Raster &raster, Object &object, const Color &color);
+static void RasterEdges(Raster &raster, Object &object, Color color = Color(),
+                        const StrokeStyle *pStroke = NULL);
 
 
 /*############################################################################*/
@@ -484,10 +552,83 @@ static const Color mTileColors[2] = { Color(255, 127,   0),
 static CamManager  gCameras;
   /* std::vector<...> to manage the background tiles. */
 static std::vector<Tile>       gBckGrndTiles;
-  /* std::vector<...> to manage the dynamic objects. */
+  /* Description of the background tile grid used to draw it procedurally. */
+static CheckerGrid             gBckGrndGrid;
+  /* Bumped whenever the background tiles are regenerated. */
+static unsigned                gBckGrndVersion = 0;
+  /* The background as drawn last time the camera held still. */
+static LayerCache              gBckGrndLayer;
+  /* An earlier rendering of the background, warped into moving views. */
+static BackgroundReprojector   gBckGrndReprojector;
+  /*
+   * std::vector<...> to manage the dynamic objects (or, when objects are
+   * grouped, the moving parents of each group).
+   */
 static std::vector<DynamicObj> gDynamicObjects;
+  /* The scene graph node of each drawn dynamic object. */
+static std::vector<SceneGraph::NodeId> gDynamicNodes;
+  /*
+   * The mesh shared by every dynamic object when they are drawn as instances:
+   * the CustomMesh, optimized and packed into [gDynamicLayout] by InitFrame().
+   */
+static PackedMeshLayout        gDynamicLayout;
+static PackedMesh              gDynamicMesh(gDynamicLayout);
+  /* The texture of the dynamic objects (when they are textured). */
+static Texture                 gDynamicTexture;
+  /* The levels of detail of the dynamic objects' mesh. */
+static MeshLod                 gDynamicLod;
+  /* The object-to-device transformation of each drawn object this frame. */
+static std::vector<Affine2x3>  gDynamicXforms;
+  /* The face color of each drawn dynamic object. */
+static std::vector<Color>      gDynamicColors;
   /* Store the tentative time elapsed since the start of the program. */
 float gCurrentTime = 0.0;
+  /* The color of the dynamic camera's square when viewed from the static camera. */
+static const Color gCamObjEdgeColor(155, 25, 25);
+  /* The options used to render each frame. */
+static RenderOptions gRenderOptions;
+  /* The statistics gathered while drawing the last frame. */
+static FrameStats    gFrameStats;
+  /* Worker threads used to update/transform the dynamic objects in parallel. */
+static std::unique_ptr<TaskPool> gTaskPool;
+  /* The configuration used to generate the scene. */
+static SceneConfig   gSceneConfig;
+  /* The measurements taken while generating the scene. */
+static SceneStats    gSceneStats;
+
+  /*
+   * Damage tracking: the pixels each drawn item (every dynamic object, then
+   * each piece of the dynamic camera's square's edges) may touch this frame,
+   * and the view/background the previous frame was drawn with.
+   */
+static DamageTracker          gDamage;
+static std::vector<DirtyRect> gItemBounds;
+static Affine2x3              gPrevView;
+static unsigned               gPrevBckGrndKey = 0;
+  /* The dynamic objects touching the dirty rectangle being redrawn. */
+static std::vector<int>       gItemOrder;
+  /* The order the dynamic objects are drawn in (empty for submission order). */
+static std::vector<int>       gDrawOrder;
+  /* The pixels already drawn this frame when drawing it front to back. */
+static SpanBuffer             gCoverage;
+  /* The samples along the dynamic objects' edges when multisampling. */
+static SampleBuffer           gSamples;
+
+  /* Short-hand typedef for the clock used to time each stage of the frame. */
+typedef std::chrono::steady_clock FrameClock;
+
+  /* Get the time (in milliseconds) elapsed since [start]. */
+static double ElapsedMs(FrameClock::time_point start)
+{ return std::chrono::duration<double, std::milli>(FrameClock::now() - start).count(); }
+
+  /* Add the time each thread spent on the task pool's last job to [threadMs]. */
+static void AddThreadTimings(std::vector<double> &threadMs)
+{
+  const std::vector<double> &timings = gTaskPool->LastTimings();
+  threadMs.resize(std::max(threadMs.size(), timings.size()), 0.0);
+  for (std::size_t t = 0; t < timings.size(); ++t)
+    threadMs[t] += timings[t];
+}
 
 
 /*############################################################################*/
@@ -509,8 +650,21 @@ float gCurrentTime = 0.0;
 *******************************************************************************/
 void InitFrame(int width, int height)
 {
-    /* Seed the random number generator. */
-  srand(static_cast<unsigned int>(time(NULL)));
+  FrameClock::time_point genStart = FrameClock::now();
+
+    /* Pick the seed the scene is generated from. */
+  unsigned seed = gSceneConfig.mSeed;
+  if (seed == 0)
+    seed = static_cast<unsigned int>(time(NULL));
+    /*
+     * Seed the random number generator (still used for the camera's
+     * path) so the whole scene can be reproduced from the seed.
+     */
+  srand(seed);
+    /* Spin up the worker threads used by the update/transform stage. */
+  gTaskPool.reset(new TaskPool(gRenderOptions.mWorkerThreads));
+    /* Start from an empty scene graph. */
+  gSceneGraph.Clear();
     /* Initialize the cameras according to the screen dimensions. */
   gCameras.Init(width, height);
 
@@ -528,51 +682,258 @@ void InitFrame(int width, int height)
      * negative of half the screen's width. To ensure that all of the
      * static camera's background is covered, 3/4 is used instead of 1/2
      */
-  const float xStartPos = -(gCameras.GetStaticCamW() * 0.75f);
+  float xStartPos = -(gCameras.GetStaticCamW() * 0.75f);
     /*
      * Set the starting y-position for the background grid based on
      * the camera height. As with the rows, start at half of the
      * screen's height due to the origin being in the center of the screen.
      */
-  float yPos = (gCameras.GetStaticCamW() * 0.5f);
+  float yStartPos = (gCameras.GetStaticCamW() * 0.5f);
+    /* A configured grid size overrides the above and is centered instead. */
+  if (gSceneConfig.mTileGridSize > 0)
+  {
+    count     = gSceneConfig.mTileGridSize;
+    xStartPos = -(0.5f * static_cast<float>(count - 1));
+    yStartPos =  (0.5f * static_cast<float>(count - 1));
+  }
+
+    /*
+     * Allocate every tile up front, then initialize the rows in parallel.
+     * Tile (row, col) sits 1 unit right/down of its neighbors, and
+     * alternating the color on (row + col) makes each row start on the
+     * opposite color of the previous one.
+     */
+  gBckGrndTiles.clear();
+  gBckGrndTiles.resize(static_cast<std::size_t>(count) * count);
+  gTaskPool->ParallelFor(count,
+                         [count, xStartPos, yStartPos] (int begin, int end, int)
+                         {
+                           for (int iRow = begin; iRow < end; ++iRow)
+                             for (int iCol = 0; iCol < count; ++iCol)
+                               gBckGrndTiles[(iRow * count) + iCol].Init(
+                                 Vector((xStartPos + iCol), (yStartPos - iRow)),
+                                 mTileColors[(iRow + iCol) % 2]);
+                         },
+                         gMinObjectsPerThread / count + 1);
+    /* Describe the same grid for the procedural background pass. */
+  gBckGrndGrid.mCorner     = Point((xStartPos - 0.5f), (yStartPos + 0.5f));
+  gBckGrndGrid.mCount      = count;
+  gBckGrndGrid.mColors[0]  = mTileColors[0];
+  gBckGrndGrid.mColors[1]  = mTileColors[1];
+  gBckGrndGrid.mClearColor = Color(255, 255, 255);
+    /* Any cached copy of the background (or of the last frame) is now out of date. */
+  ++gBckGrndVersion;
+  gBckGrndLayer.Invalidate();
+  gBckGrndReprojector.Invalidate();
+  gDamage.Invalidate();
+
+    /*
+     * Drop the shared mesh's repeated and degenerate primitives and reorder
+     * the rest to be walked in order, then pack its indices to 16 bits.
+     */
+  MeshLayout         dynamicLayout;
+  MeshOptimizeReport dynamicReport;
+  CustomMesh         authoredMesh;
+  CopyMeshLayout(authoredMesh, dynamicLayout);
+  OptimizeMeshLayout(dynamicLayout, &dynamicReport);
+  PackMeshLayout(dynamicLayout, gDynamicLayout);
+  gDynamicMesh.SetCenter(gDynamicLayout.mCenter);
 
-    /* Loop through each row of background tiles. */
-  for (int iRow = 0, iColor = 0; iRow < count; ++iRow)
+    /*
+     * Shaded objects are lit from the top left: each vertex of the shared
+     * mesh gets a grey level by how far it lies towards the light, which then
+     * tints the face color of every object drawn with it.
+     */
+  gDynamicMesh.mVertColors.clear();
+  if (gSceneConfig.mShadedObjects)
+  {
+    const Point center = gDynamicMesh.Center();
+    float       reach  = 0.0f;
+    for (int v = 0; v < gDynamicMesh.VertexCount(); ++v)
+      reach = std::max(reach, std::hypot((gDynamicMesh.GetVertex(v).x - center.x),
+                                         (gDynamicMesh.GetVertex(v).y - center.y)));
+    for (int v = 0; v < gDynamicMesh.VertexCount(); ++v)
+    {
+      const Point &vertex = gDynamicMesh.GetVertex(v);
+      const float  toward = ((reach > 0.0f)
+                             ? ((((center.x - vertex.x) * 0.6f) +
+                                 ((vertex.y - center.y) * 0.8f)) / reach)
+                             : 0.0f);
+      const Cval   grey   = static_cast<Cval>(255.0f * (0.65f + (0.35f * toward)));
+      gDynamicMesh.mVertColors.push_back(Color(grey, grey, grey));
+    }
+  }
+
+    /*
+     * Textured objects are covered in bricks: a greyscale texture (tinted by
+     * each object's color) repeated twice across the mesh's bounding box.
+     */
+  gDynamicMesh.mpTexture = NULL;
+  gDynamicMesh.mVertUVs.clear();
+  if (gSceneConfig.mTexturedObjects)
   {
-      /* Set the start position for the start of the row. */
-    float xPos = xStartPos;
-      /* Loop through each column in this row and create the checkered tiles. */
-    for (int iCol = 0; iCol < count; xPos += 1.0f, ++iColor, ++iCol)
-      gBckGrndTiles.push_back(Tile(Vector(xPos, yPos),
-                                   mTileColors[iColor % 2]));
-      /* Move to the next row. */
-    yPos -= 1.0f;
-      /* Ensure that each row starts on the opposite color of the previous. */
-    iColor += ((count + 1) % 2);
+    static const int texSize = 64;
+    std::vector<Color> bricks(texSize * texSize);
+    for (int y = 0; y < texSize; ++y)
+      for (int x = 0; x < texSize; ++x)
+      {
+          /* Rows of bricks 8 texels high and 16 wide, every other row offset. */
+        const int  bx     = ((x + (((y / 8) % 2) * 8)) % 16);
+        const bool mortar = (((y % 8) == 0) || (bx == 0));
+        const Cval grey   = static_cast<Cval>(mortar ? 110 : (215 + (((x * 7) + (y * 13)) % 40)));
+        bricks[(y * texSize) + x] = Color(grey, grey, grey);
+      }
+    gDynamicTexture.Load(texSize, texSize, &bricks[0]);
+    gDynamicTexture.SetBilinear(gRenderOptions.mBilinearTextures);
+
+    Point lo = gDynamicMesh.GetVertex(0);
+    Point hi = lo;
+    for (int v = 1; v < gDynamicMesh.VertexCount(); ++v)
+    {
+      const Point &vertex = gDynamicMesh.GetVertex(v);
+      lo = Point(std::min(lo.x, vertex.x), std::min(lo.y, vertex.y));
+      hi = Point(std::max(hi.x, vertex.x), std::max(hi.y, vertex.y));
+    }
+    for (int v = 0; v < gDynamicMesh.VertexCount(); ++v)
+    {
+      const Point &vertex = gDynamicMesh.GetVertex(v);
+      gDynamicMesh.mVertUVs.push_back(Point(((2.0f * (vertex.x - lo.x)) / (hi.x - lo.x)),
+                                            ((2.0f * (vertex.y - lo.y)) / (hi.y - lo.y))));
+    }
+    gDynamicMesh.mpTexture = &gDynamicTexture;
   }
+    /* Simplify the shared mesh for the objects that end up small on screen. */
+  BuildMeshLod(gDynamicMesh, gDynamicLod);
 
     /* Get the screens (min/max)imum x-values */
   float screenWidth = (gCameras.GetStaticCamW() * 0.5f);
     /*
      * Generate the dynamic objects at random positions
      * (contained within the screen) and random sizes/rotation rates.
+     * Each object draws from its own random stream (keyed by its index) so
+     * the objects can be generated in parallel and still come out the same
+     * for a given seed.
      */
-  for (int i = 0; i < gDynamicObjCount; ++i)
-    gDynamicObjects.push_back(DynamicObj(Vector(frand(-screenWidth, screenWidth),
-                                                frand(-screenWidth, screenWidth)),
-                                         frand(0.10f, 0.25f),
-                                         (PI / frand(2.0f, 10.0f)),
-                                         Vector(frand(-0.0125f, 0.0125f), frand(-0.0125f, 0.0125f)),
-                                         Color(irand(0.0f, 255.0f),
-                                               irand(0.0f, 255.0f),
-                                               irand(0.0f, 255.0f))));
-  
-//    /* Default constructor. */
-//  DynamicObj(const Vector &pos       = Vector(0.0f, 0.0f),
-//                   float   scale     = 1.0f,
-//                   float   rotRate   = 0.0f,
-//             const Vector &velocity  = Vector(0.0f, 0.0f),
-//             const Color  &faceColor = Color(255, 255, 255))
+  const int objCount    = std::max(0, gSceneConfig.mDynamicObjCount);
+  const int clusterSize = std::max(1, gSceneConfig.mClusterSize);
+  const int firstNode   = gSceneGraph.NodeCount();
+
+  gDynamicNodes.resize(objCount);
+  gDynamicColors.resize(objCount);
+  gDynamicXforms.assign(objCount, Affine2x3());
+  gDynamicObjects.clear();
+
+  if (clusterSize == 1)
+  {
+      /* Every object moves on its own and gets its own root node. */
+    gDynamicObjects.resize(objCount);
+    gSceneGraph.Resize(firstNode + objCount);
+    gTaskPool->ParallelFor(objCount,
+                           [seed, screenWidth, firstNode] (int begin, int end, int)
+                           {
+                             for (int i = begin; i < end; ++i)
+                             {
+                               CounterRng rng(seed, i);
+                               Vector pos(rng.Float(-screenWidth, screenWidth),
+                                          rng.Float(-screenWidth, screenWidth));
+                               float  scale   = rng.Float(0.10f, 0.25f);
+                               float  rotRate = (PI / rng.Float(2.0f, 10.0f));
+                               Vector vel(rng.Float(-0.0125f, 0.0125f),
+                                          rng.Float(-0.0125f, 0.0125f));
+                               Color  color(rng.Int(0, 255),
+                                            rng.Int(0, 255),
+                                            rng.Int(0, 255));
+
+                               DynamicObj &object = gDynamicObjects[i];
+                               object.Init(gDynamicMesh.Center(), pos, scale, rotRate, vel);
+                               object.mNode = (firstNode + i);
+                               gSceneGraph.InitNode(object.mNode,
+                                                    SceneGraph::scmNoParent,
+                                                    Affine2x3());
+                               gDynamicNodes[i]  = object.mNode;
+                               gDynamicColors[i] = color;
+                             }
+                           },
+                           gMinObjectsPerThread);
+  }
+  else
+  {
+      /*
+       * Group the objects: each group gets a moving parent node followed
+       * directly by its members' nodes, so a group's subtree is contiguous
+       * in the scene graph. Members never change their local transformation,
+       * only the parent does.
+       */
+    const int groupCount = ((objCount + clusterSize - 1) / clusterSize);
+
+    gDynamicObjects.resize(groupCount);
+    gSceneGraph.Resize(firstNode + groupCount + objCount);
+    gTaskPool->ParallelFor(groupCount,
+                           [=] (int begin, int end, int)
+                           {
+                             for (int g = begin; g < end; ++g)
+                             {
+                                 /* Parent streams follow the objects' streams. */
+                               CounterRng rng(seed, (objCount + g));
+                               Vector pos(rng.Float(-screenWidth, screenWidth),
+                                          rng.Float(-screenWidth, screenWidth));
+                               float  rotRate = (PI / rng.Float(2.0f, 10.0f));
+                               Vector vel(rng.Float(-0.0125f, 0.0125f),
+                                          rng.Float(-0.0125f, 0.0125f));
+
+                               DynamicObj &parent = gDynamicObjects[g];
+                               parent.Init(gDynamicMesh.Center(), pos, 1.0f, rotRate, vel);
+                               parent.mNode = (firstNode + (g * (clusterSize + 1)));
+                               gSceneGraph.InitNode(parent.mNode,
+                                                    SceneGraph::scmNoParent,
+                                                    Affine2x3());
+
+                               for (int m = 0; m < clusterSize; ++m)
+                               {
+                                 int i = ((g * clusterSize) + m);
+                                 if (i >= objCount)
+                                   break;
+
+                                 CounterRng crng(seed, i);
+                                 Vector offset(crng.Float(-gClusterRadius, gClusterRadius),
+                                               crng.Float(-gClusterRadius, gClusterRadius));
+                                 float  scale = crng.Float(0.10f, 0.25f);
+                                 Color  color(crng.Int(0, 255),
+                                              crng.Int(0, 255),
+                                              crng.Int(0, 255));
+
+                                 gDynamicNodes[i]  = (parent.mNode + 1 + m);
+                                 gDynamicColors[i] = color;
+                                 gSceneGraph.InitNode(gDynamicNodes[i],
+                                                      parent.mNode,
+                                                      Affine2x3(Trans(offset) *
+                                                                Scale(scale)  *
+                                                                Trans(gOrigin - gDynamicMesh.Center())));
+                               }
+                             }
+                           },
+                           (gMinObjectsPerThread / clusterSize) + 1);
+  }
+  gSceneGraph.Update();
+
+    /* Record how long generation took and how much memory each object uses. */
+  gSceneStats.mSeed               = seed;
+  gSceneStats.mDynamicObjCount    = gDynamicNodes.size();
+  gSceneStats.mTileCount          = gBckGrndTiles.size();
+  gSceneStats.mGenerateMs         = ElapsedMs(genStart);
+  gSceneStats.mBytesPerDynamicObj =
+    (objCount ? ((((gDynamicObjects.size() * sizeof(DynamicObj)) +
+                   (gSceneGraph.NodeCount() * (sizeof(SceneGraph::NodeId) +
+                                               (2 * sizeof(Affine2x3)) + 1))) /
+                  objCount) +
+                 sizeof(SceneGraph::NodeId) +
+                 sizeof(Affine2x3)          +
+                 sizeof(Color))
+              : 0);
+  gSceneStats.mBytesPerTile       = (sizeof(Tile) +
+                                     (SquareMesh().VertexCount() * sizeof(Point)));
+  gSceneStats.mDynamicMeshBytesBefore = dynamicReport.mBytesBefore;
+  gSceneStats.mDynamicMeshBytesAfter  = dynamicReport.mBytesAfter;
 }
 
 /*!
@@ -593,43 +954,499 @@ void InitFrame(int width, int height)
 *******************************************************************************/
 void DrawFrame(Raster &raster, double dt, int camNum)
 {
-    /* Set background to white. */
-  raster.SetColor(255, 255, 255);
-  FillRect(raster, 0, 0, gCameras.GetScreenW(), gCameras.GetScreenH());
     /* Get the world-to-device transform for the current camera. */
   Affine worldToDev = gCameras.GetWorldToDev(camNum);
-    /* Loop through each tile in the background and draw them to the pixel buffer. */
-  std::for_each(gBckGrndTiles.begin(), gBckGrndTiles.end(),
-                [&raster, worldToDev] (Tile &tile)
-                { tile.Transform(worldToDev, gCurrentTime); Rasterize(raster, tile); } );
+    /*
+     * The background only depends on the camera, the tiles and the options
+     * it is drawn with, so while none of them change (e.g. when viewing
+     * through the static camera) it is copied from the cached layer instead
+     * of drawn again.
+     */
+  const unsigned bckGrndKey = ((gBckGrndVersion << 2)                          |
+                               (gRenderOptions.mProceduralBackground ? 2u : 0u) |
+                               (gRenderOptions.mTileBorders          ? 1u : 0u));
 
-    /* Loop through each tile in the background and draw them to the pixel buffer. */
-  std::for_each(gDynamicObjects.begin(), gDynamicObjects.end(),
-                [&raster, worldToDev] (DynamicObj &tile)
-                { tile.Transform(worldToDev, gCurrentTime); Rasterize(raster, tile); } );
+    /*
+     * Update every dynamic object (or group parent) in parallel, storing its
+     * new local transformation in the scene graph. Each object only touches
+     * its own state and node, so the objects are split into fixed contiguous
+     * chunks, one per thread.
+     */
+  FrameClock::time_point stageStart = FrameClock::now();
+  gTaskPool->ParallelFor(static_cast<int>(gDynamicObjects.size()),
+                         [] (int begin, int end, int)
+                         {
+                           for (int i = begin; i < end; ++i)
+                             gSceneGraph.SetLocal(gDynamicObjects[i].mNode,
+                                                  Affine2x3(gDynamicObjects[i].Update(gCurrentTime)));
+                         },
+                         gMinObjectsPerThread);
+  gFrameStats.mTransformThreadMs.clear();
+  AddThreadTimings(gFrameStats.mTransformThreadMs);
+    /* Propagate the changes down to the world transformations. */
+  gFrameStats.mWorldUpdates = gSceneGraph.Update();
+    /* Combine each drawn object's world transformation with the camera's. */
+  const Affine2x3 worldToDev2x3(worldToDev);
+  gTaskPool->ParallelFor(static_cast<int>(gDynamicNodes.size()),
+                         [worldToDev2x3] (int begin, int end, int)
+                         {
+                           for (int i = begin; i < end; ++i)
+                             gDynamicXforms[i] = (worldToDev2x3 *
+                                                  gSceneGraph.GetWorld(gDynamicNodes[i]));
+                         },
+                         gMinObjectsPerThread);
+  AddThreadTimings(gFrameStats.mTransformThreadMs);
+  gFrameStats.mTransformMs = ElapsedMs(stageStart);
 
-    /* Update the cameras. */
+    /*
+     * Update the cameras (and the camera's nodes in the scene graph). The
+     * view was fetched above, so this only moves the dynamic camera's square.
+     */
   gCameras.Update(gCurrentTime, static_cast<float>(dt));
+  gFrameStats.mWorldUpdates += gSceneGraph.Update();
     /*
-     * If we are currently viewing through the static camera,
-     * draw the dynamic camera's square representation.
+     * If we are currently viewing through the static camera, the dynamic
+     * camera's square representation is drawn on top of everything else.
      */
+  Object *pCamObj = NULL;
   if (camNum == CamManager::scmStaticCam)
   {
-      /* Get a reference to the CamObj representing the dynamic camera. */
-    Object &camObj = gCameras.GetCamObj();
-      /* Transform it's vertices. */
-    camObj.Transform(worldToDev, gCurrentTime);
+    pCamObj = &gCameras.GetCamObj();
+    pCamObj->Transform(worldToDev, gCurrentTime);
+    pCamObj->mFaceColor = gCamObjEdgeColor;
+    pCamObj->mFaceAlpha = ToAlpha(gRenderOptions.mCamSquareAlpha);
+  }
+
+    /*
+     * Every dynamic object shares the same mesh, so transform them all as
+     * instances of it in one batch, noting the pixels each of them (and each
+     * of the square's edges) may touch this frame.
+     */
+  stageStart = FrameClock::now();
+  const int instCount = static_cast<int>(gDynamicXforms.size());
+  const int edgeCount = (pCamObj ? pCamObj->GetMesh().EdgeCount() : 0);
+  const StrokeStyle *pStroke = WideStroke(gRenderOptions.mOutlineStroke);
+  const float        reach   = (pStroke ? StrokeReach(*pStroke) : 0.0f);
+  gItemBounds.resize(instCount + (edgeCount * gEdgePieces));
+  TransformInstances(gDynamicMesh,
+                     (instCount ? &gDynamicXforms[0] : NULL),
+                     instCount,
+                     raster.Width(),
+                     raster.Height(),
+                     (instCount ? &gItemBounds[0] : NULL),
+                     gTaskPool.get(),
+                     reach,
+                     ((0.0f < gRenderOptions.mLodPixelError) ? &gDynamicLod : NULL),
+                     gRenderOptions.mLodPixelError);
+  AddThreadTimings(gFrameStats.mTransformThreadMs);
+  gFrameStats.mLodObjects.clear();
+  gFrameStats.mObjectPrimitives = 0;
+  if ((0.0f < gRenderOptions.mLodPixelError) && instCount)
+    gFrameStats.mObjectPrimitives = CountInstanceLevels(gFrameStats.mLodObjects);
+    /*
+     * The square's edges are long and usually slanted, so the bounds of each
+     * are split into pieces instead of one box covering its whole span.
+     */
+  for (int e = 0; e < edgeCount; ++e)
+  {
+    MyMesh           &mesh = pCamObj->GetMesh();
+    const Mesh::Edge &edge = mesh.GetEdge(e);
+    const Point      &P    = mesh.mTempVerts[edge.index1];
+    const Vector      PQ   = (mesh.mTempVerts[edge.index2] - P);
+    for (int k = 0; k < gEdgePieces; ++k)
+      gItemBounds[instCount + (e * gEdgePieces) + k] =
+        LineBounds((P + ((static_cast<float>(k)     / gEdgePieces) * PQ)),
+                   (P + ((static_cast<float>(k + 1) / gEdgePieces) * PQ)),
+                   raster.Width(),
+                   raster.Height(),
+                   reach);
+  }
+
+    /*
+     * With damage tracking, a frame of the same view as the last one (whose
+     * background is cached) only redraws the regions that changed.
+     */
+  const Affine2x3 view(worldToDev);
+  bool incremental = false;
+  if (gRenderOptions.mDamageTracking && !gRenderOptions.mFrontToBack &&
+      !gRenderOptions.mMultisamples && !gRenderOptions.mSmoothLines &&
+      !gRenderOptions.mCamSquareAlpha)
+  {
+    if (!(view == gPrevView)              ||
+        (bckGrndKey != gPrevBckGrndKey)   ||
+        !gRenderOptions.mCacheStaticLayer ||
+        !gBckGrndLayer.IsValid(raster, worldToDev, bckGrndKey))
+      gDamage.Invalidate();
+    incremental = gDamage.Track(gItemBounds, raster.Width(), raster.Height());
+  }
+  else
+    gDamage.Invalidate();
+  gPrevView       = view;
+  gPrevBckGrndKey = bckGrndKey;
+
+    /*
+     * Optionally reorder the objects so that consecutive ones land close
+     * together on screen (overlapping ones keeping their order).
+     */
+  gDrawOrder.clear();
+  gFrameStats.mDrawLayers     = 0;
+  gFrameStats.mResolvedPixels = 0;
+  if (!incremental && gRenderOptions.mSortDraws && instCount)
+    gFrameStats.mDrawLayers = SortDrawOrder(&gItemBounds[0], instCount,
+                                            raster.Width(), raster.Height(),
+                                            gDrawOrder);
+
+  if (incremental)
+  {
+    gFrameStats.mBackgroundCached      = true;
+    gFrameStats.mBackgroundReprojected = false;
+    gFrameStats.mExposedPixels         = 0;
+    gFrameStats.mClearedPixels         = 0;
+    gFrameStats.mBackgroundMs          = 0.0;
+    DrawDirtyRects(raster, pCamObj);
+    gFrameStats.mDirtyRects = gDamage.DirtyRects();
+  }
+  else if (gRenderOptions.mFrontToBack)
+  {
+    gFrameStats.mBackgroundCached      = false;
+    gFrameStats.mBackgroundReprojected = false;
+    gFrameStats.mExposedPixels         = 0;
+    gFrameStats.mClearedPixels         = 0;
+    gFrameStats.mBackgroundMs          = 0.0;
+    DrawFrontToBack(raster, worldToDev, pCamObj);
+    gFrameStats.mDirtyRects.assign(1, DirtyRect(0, 0, raster.Width(), raster.Height()));
+  }
+  else
+  {
+    FrameClock::time_point bckGrndStart = FrameClock::now();
+    gFrameStats.mBackgroundCached = (gRenderOptions.mCacheStaticLayer &&
+                                     gBckGrndLayer.Restore(raster, worldToDev, bckGrndKey));
+    gFrameStats.mBackgroundReprojected = false;
+    gFrameStats.mExposedPixels         = 0;
+    gFrameStats.mClearedPixels         = 0;
+    if (!gFrameStats.mBackgroundCached)
+    {
+      DrawBackground(raster, worldToDev);
+        /* Only exact renderings are worth keeping. */
+      if (gRenderOptions.mCacheStaticLayer && !gFrameStats.mBackgroundReprojected)
+        gBckGrndLayer.Offer(raster, worldToDev, bckGrndKey);
+    }
+    gFrameStats.mBackgroundMs = ElapsedMs(bckGrndStart);
+
+      /*
+       * Draw the objects (in submission order, or sorted), then the square on
+       * top, gathering the samples along the objects' edges if multisampling.
+       */
+    if (gRenderOptions.mMultisamples)
+    {
+      gSamples.Init(raster.Width(), raster.Height(), gRenderOptions.mMultisamples);
+      raster.SetSamples(&gSamples);
+    }
+    raster.SetAlpha(ToAlpha(gRenderOptions.mObjectAlpha));
+    DrawTransformedInstances(raster,
+                             (gDynamicColors.empty() ? NULL : &gDynamicColors[0]),
+                             (gDrawOrder.empty() ? NULL : &gDrawOrder[0]),
+                             instCount,
+                             Color(),
+                             DirtyRect(0, 0, raster.Width(), raster.Height()),
+                             NULL,
+                             false,
+                             gRenderOptions.mSmoothLines,
+                             pStroke);
+    raster.SetAlpha(gOpaqueAlpha);
       /*
-       * Draw only the edge so we can still see the objects
-       * that the dynamic camera would be viewing.
+       * Draw the square's edges (over a translucent fill, if any) so we can
+       * still see the objects that the dynamic camera would be viewing.
        */
-    RasterEdges(raster, camObj, Color(155, 25, 25));
+    if (pCamObj)
+    {
+      if (pCamObj->mFaceAlpha)
+        RasterFaces(raster, *pCamObj);
+      RasterEdges(raster, *pCamObj, gCamObjEdgeColor, pStroke);
+    }
+    if (raster.GetSamples())
+    {
+      raster.SetSamples(NULL);
+      gFrameStats.mResolvedPixels = gSamples.Resolve(raster.Buffer(), raster.Stride());
+    }
+    gFrameStats.mDirtyRects.assign(1, DirtyRect(0, 0, raster.Width(), raster.Height()));
+  }
+  gFrameStats.mRasterMs = (ElapsedMs(stageStart) - gFrameStats.mBackgroundMs);
+  if (!gRenderOptions.mFrontToBack || incremental)
+  {
+    gFrameStats.mPaintedPixels = 0;
+    gFrameStats.mWrittenPixels = 0;
   }
+
+  gFrameStats.mDirtyPixels = 0;
+  for (auto iter = gFrameStats.mDirtyRects.begin(); iter != gFrameStats.mDirtyRects.end(); ++iter)
+    gFrameStats.mDirtyPixels += iter->Area();
+
     /* Update the current time. */
   gCurrentTime += static_cast<float>(dt);
 }
 
+/*!
+******************************************************************************
+  \fn void DrawDirtyRects(Raster &raster, Object *pCamObj)
+
+  \brief
+    Bring the previous frame up to date by redrawing only the dirty
+    rectangles found by the damage tracker: each one gets its background
+    restored from the cached layer, then the dynamic objects touching it are
+    drawn again (in their usual order) clipped to it. The dynamic camera's
+    square is drawn on top once every rectangle is done.
+
+  \param raster
+    The Raster object holding the previous frame.
+
+  \param pCamObj
+    The dynamic camera's square (or NULL when it is not drawn).
+*******************************************************************************/
+void DrawDirtyRects(Raster &raster, Object *pCamObj)
+{
+  const std::vector<DirtyRect> &rects = gDamage.DirtyRects();
+  const int instCount = static_cast<int>(gDynamicXforms.size());
+
+  for (auto rect = rects.begin(); rect != rects.end(); ++rect)
+  {
+    Clip rectClip = RectClip(rect->mX0, rect->mY0, rect->mX1, rect->mY1,
+                             raster.Width(), raster.Height());
+
+    gBckGrndLayer.RestoreRect(raster, rect->mX0, rect->mY0, rect->mX1, rect->mY1);
+
+      /* Redraw the dynamic objects touching the rectangle, in order. */
+    gItemOrder.clear();
+    for (int i = 0; i < instCount; ++i)
+      if (gItemBounds[i].Overlaps(*rect))
+        gItemOrder.push_back(i);
+    raster.SetAlpha(ToAlpha(gRenderOptions.mObjectAlpha));
+    DrawTransformedInstances(raster,
+                             (gDynamicColors.empty() ? NULL : &gDynamicColors[0]),
+                             (gItemOrder.empty() ? NULL : &gItemOrder[0]),
+                             static_cast<int>(gItemOrder.size()),
+                             Color(),
+                             *rect,
+                             &rectClip,
+                             false,
+                             false,
+                             WideStroke(gRenderOptions.mOutlineStroke));
+    raster.SetAlpha(gOpaqueAlpha);
+  }
+
+    /*
+     * The square is drawn on top of everything else, so its edges can be
+     * drawn whole (their pixels outside the dirty rectangles already hold
+     * the same color), which keeps them from being cut at every rectangle.
+     */
+  if (pCamObj && !rects.empty())
+    RasterEdges(raster, *pCamObj, gCamObjEdgeColor, WideStroke(gRenderOptions.mOutlineStroke));
+}
+
+/*!
+******************************************************************************
+  \fn DirtyRect LineBounds(const Point &P, const Point &Q, int width,
+                           int height, float reach)
+
+  \brief
+    Get the pixels of a [width] x [height] screen that a line drawn from [P]
+    to [Q] may touch.
+
+  \param P
+    The start point of the line (in device coordinates).
+
+  \param Q
+    The end point of the line (in device coordinates).
+
+  \param width
+    The width of the screen.
+
+  \param height
+    The height of the screen.
+
+  \param reach
+    How far (in pixels) the line reaches past [P] and [Q] (when stroked).
+
+  \return
+    The bounds of the line (empty if it is entirely off screen).
+*******************************************************************************/
+DirtyRect LineBounds(const Point &P, const Point &Q, int width, int height, float reach)
+{
+    /* Pad by a pixel on each side (plus its reach) to cover the line's rounding. */
+  DirtyRect bounds(std::max(static_cast<int>(std::floor(std::min(P.x, Q.x) - reach)) - 1, 0),
+                   std::max(static_cast<int>(std::floor(std::min(P.y, Q.y) - reach)) - 1, 0),
+                   std::min(static_cast<int>(std::ceil (std::max(P.x, Q.x) + reach)) + 2, width),
+                   std::min(static_cast<int>(std::ceil (std::max(P.y, Q.y) + reach)) + 2, height));
+
+  return (bounds.IsEmpty() ? DirtyRect() : bounds);
+}
+
+/*!
+******************************************************************************
+  \fn void DrawFrontToBack(Raster &raster, const Affine &worldToDev,
+                           Object *pCamObj)
+
+  \brief
+    Draw the whole frame nearest first: the dynamic camera's square, the
+    dynamic objects from last to first (each one's edges before its faces),
+    the tile borders, then the background tiles. Every write is checked
+    against the span buffer, so each pixel is only written by the first
+    (i.e. topmost) thing drawn over it, and the background only fills the
+    gaps left on each scanline. This produces the same frame as painting
+    everything back to front.
+
+  \param raster
+    The Raster object that the frame will be drawn to.
+
+  \param worldToDev
+    The world-to-device transformation of the current camera.
+
+  \param pCamObj
+    The dynamic camera's square (or NULL when it is not drawn).
+*******************************************************************************/
+void DrawFrontToBack(Raster &raster, const Affine &worldToDev, Object *pCamObj)
+{
+  const int width = raster.Width();
+
+  gCoverage.Reset(raster.Height());
+  raster.SetCoverage(&gCoverage);
+
+  if (pCamObj)
+    RasterEdges(raster, *pCamObj, gCamObjEdgeColor, WideStroke(gRenderOptions.mOutlineStroke));
+  DrawTransformedInstances(raster,
+                           (gDynamicColors.empty() ? NULL : &gDynamicColors[0]),
+                           (gDrawOrder.empty() ? NULL : &gDrawOrder[0]),
+                           static_cast<int>(gDynamicXforms.size()),
+                           Color(),
+                           DirtyRect(0, 0, width, raster.Height()),
+                           NULL,
+                           true,
+                           false,
+                           WideStroke(gRenderOptions.mOutlineStroke));
+
+  if (gRenderOptions.mProceduralBackground)
+  {
+    gBckGrndGrid.mBorders = gRenderOptions.mTileBorders;
+    if (gBckGrndGrid.mBorders)
+      DrawCheckerBorders(raster, worldToDev, gBckGrndGrid);
+
+      /* Claim what is left of each scanline, then draw the tiles there. */
+    const Affine devToWorld = Inverse(worldToDev);
+    raster.SetCoverage(NULL);
+    for (int y = 0; y < raster.Height(); ++y)
+    {
+      const std::vector<SpanBuffer::Span> &free = gCoverage.ClaimSpan(y, 0, width);
+      for (auto run = free.begin(); run != free.end(); ++run)
+        DrawCheckerboardRow(raster, devToWorld, gBckGrndGrid, y, run->mX0, run->mX1);
+    }
+  }
+  else
+  {
+      /* The tiles from last to first, each one's edges before its faces. */
+    std::for_each(gBckGrndTiles.rbegin(), gBckGrndTiles.rend(),
+                  [&raster, worldToDev] (Tile &tile)
+                  {
+                    tile.Transform(worldToDev, gCurrentTime);
+                    RasterEdges(raster, tile);
+                    RasterFaces(raster, tile);
+                  } );
+      /* Then white wherever no tile landed. */
+    raster.SetColor(255, 255, 255);
+    for (int y = 0; y < raster.Height(); ++y)
+    {
+      raster.GotoPoint(0, y);
+      raster.WriteSpan(width);
+    }
+    raster.SetCoverage(NULL);
+  }
+
+  gFrameStats.mPaintedPixels = gCoverage.RequestedPixels();
+  gFrameStats.mWrittenPixels = gCoverage.WrittenPixels();
+}
+
+/*!
+******************************************************************************
+  \fn void DrawBackground(Raster &raster, const Affine &worldToDev)
+
+  \brief
+    Draw the background (the tiles and the white surrounding them) to the
+    whole of the given Raster object's frame buffer.
+
+  \param raster
+    The Raster object that the background will be drawn to.
+
+  \param worldToDev
+    The world-to-device transformation of the current camera.
+*******************************************************************************/
+void DrawBackground(Raster &raster, const Affine &worldToDev)
+{
+  gBckGrndGrid.mBorders = gRenderOptions.mTileBorders;
+
+  if (!gRenderOptions.mReprojectBackground)
+  {
+    if (gRenderOptions.mProceduralBackground)
+        /*
+         * Draw the whole background (including the white surrounding the
+         * tiles) in one pass over the screen's scanlines.
+         */
+      DrawCheckerboard(raster, worldToDev, gBckGrndGrid);
+    else
+    {
+        /*
+         * Set background to white, skipping the pixels the tiles are about
+         * to cover anyway.
+         */
+      gFrameStats.mClearedPixels = ClearOutsideGrid(raster, worldToDev, gBckGrndGrid);
+        /* Loop through each tile in the background and draw them to the pixel buffer. */
+      std::for_each(gBckGrndTiles.begin(), gBckGrndTiles.end(),
+                    [&raster, worldToDev] (Tile &tile)
+                    { tile.Transform(worldToDev, gCurrentTime); Rasterize(raster, tile); } );
+    }
+    return;
+  }
+
+    /*
+     * While the camera moves, warp an earlier rendering of the tiles into
+     * the new view (only drawing what it does not cover). Otherwise draw
+     * the tiles again, without their borders, as the new reference.
+     */
+  gFrameStats.mBackgroundReprojected =
+    gBckGrndReprojector.Reproject(raster, worldToDev, gBckGrndGrid, gBckGrndVersion);
+  if (!gFrameStats.mBackgroundReprojected)
+  {
+    if (gRenderOptions.mProceduralBackground)
+    {
+      CheckerGrid tiles = gBckGrndGrid;
+      tiles.mBorders    = false;
+      DrawCheckerboard(raster, worldToDev, tiles);
+    }
+    else
+    {
+      gFrameStats.mClearedPixels = ClearOutsideGrid(raster, worldToDev, gBckGrndGrid);
+      std::for_each(gBckGrndTiles.begin(), gBckGrndTiles.end(),
+                    [&raster, worldToDev] (Tile &tile)
+                    { tile.Transform(worldToDev, gCurrentTime); RasterFaces(raster, tile); } );
+    }
+    gBckGrndReprojector.Capture(raster, worldToDev, gBckGrndVersion);
+  }
+  gFrameStats.mExposedPixels = gBckGrndReprojector.ExposedPixels();
+
+    /* The borders are always drawn exactly, over the (warped) tiles. */
+  if (gRenderOptions.mProceduralBackground)
+  {
+    if (gBckGrndGrid.mBorders)
+      DrawCheckerBorders(raster, worldToDev, gBckGrndGrid);
+  }
+  else
+    std::for_each(gBckGrndTiles.begin(), gBckGrndTiles.end(),
+                  [&raster, worldToDev] (Tile &tile)
+                  {
+                    if (gFrameStats.mBackgroundReprojected)
+                      tile.Transform(worldToDev, gCurrentTime);
+                    RasterEdges(raster, tile);
+                  } );
+}
+
 /*!
 ******************************************************************************
   \fn void Rasterize(Raster &raster, const Object &object)
@@ -647,6 +1464,8 @@ void DrawFrame(Raster &raster, double dt, int camNum)
 *******************************************************************************/
 void Rasterize(Raster &raster, Object &object)
 {
+  if (gRenderOptions.mMergedOutlines && RasterOutlined(raster, object, Color()))
+    return;
   RasterFaces(raster, object);
   RasterEdges(raster, object);
 }
@@ -666,6 +1485,28 @@ void Rasterize(Raster &raster, Object &object)
     The object to be rasterized.
 *******************************************************************************/
 void RasterFaces(Raster &raster, Object &object)
+{
+    /* Translucent faces are blended over what is already drawn. */
+  raster.SetAlpha(object.mFaceAlpha);
+  FillFaces(raster, object);
+  raster.SetAlpha(gOpaqueAlpha);
+}
+
+/*!
+******************************************************************************
+  \fn void FillFaces(Raster &raster, Object &object)
+
+  \brief
+    Clip and fill the object's faces in the Raster object's current alpha
+    (see RasterFaces).
+
+  \param raster
+    The Raster object that the object will be drawn to.
+
+  \param object
+    The object to be rasterized.
+*******************************************************************************/
+void FillFaces(Raster &raster, Object &object)
 {
     /* Reusable vertex buffer for clipping the current object. */
   static std::vector<Point> sClipVerts;
@@ -673,10 +1514,71 @@ void RasterFaces(Raster &raster, Object &object)
     /* Get a reference to the MyMesh that this object is made of. */
   MyMesh &mesh = object.GetMesh();
 
+    /* Meshes with a texture or vertex colors are filled with them instead. */
+  const bool textured = (mesh.mpTexture && !mesh.mVertUVs.empty());
+  if (textured || !mesh.mVertColors.empty())
+  {
+    for (int i = 0; i < mesh.FaceCount(); ++i)
+    {
+      const Mesh::Face &f = mesh.GetFace(i);
+      const Point &P      = mesh.mTempVerts[f.index1];
+      const Point &Q      = mesh.mTempVerts[f.index2];
+      const Point &R      = mesh.mTempVerts[f.index3];
+        /* Fit the attributes to the whole face so its clipped pieces share them. */
+      ColorPlane plane;
+      UVPlane    uvPlane;
+      if (textured)
+        uvPlane.Init(P, Q, R, mesh.mVertUVs[f.index1],
+                              mesh.mVertUVs[f.index2],
+                              mesh.mVertUVs[f.index3]);
+      else
+        plane.Init(P, Q, R, TintColor(object.mFaceColor, mesh.mVertColors[f.index1]),
+                            TintColor(object.mFaceColor, mesh.mVertColors[f.index2]),
+                            TintColor(object.mFaceColor, mesh.mVertColors[f.index3]));
+      sClipVerts.clear();
+      sClipVerts.push_back(P);
+      sClipVerts.push_back(Q);
+      sClipVerts.push_back(R);
+      if (gCameras.ClipToScreen(sClipVerts))
+      {
+        for (unsigned int j = 1; j < sClipVerts.size() - 1; ++j)
+        {
+          if (textured)
+            FillTexturedTriangle(raster, sClipVerts[0], sClipVerts[j], sClipVerts[j + 1],
+                                 uvPlane, *mesh.mpTexture, object.mFaceColor);
+          else
+            FillShadedTriangle(raster, sClipVerts[0], sClipVerts[j], sClipVerts[j + 1], plane);
+        }
+      }
+    }
+    return;
+  }
+
     /* Set the drawing color to the color of the face of the current object. */
   raster.SetColor(object.mFaceColor.red,
                   object.mFaceColor.grn,
                   object.mFaceColor.blu);
+    /*
+     * Squares stay parallelograms under any affine transformation, so fill
+     * them whole (unless multisampling, which goes a triangle at a time).
+     */
+  int corners[4];
+  const bool sampled = (raster.GetSamples() != NULL);
+  if (!sampled && FindQuad(mesh, corners) &&
+      FillQuad(raster,
+               mesh.mTempVerts[corners[0]],
+               mesh.mTempVerts[corners[1]],
+               mesh.mTempVerts[corners[2]],
+               mesh.mTempVerts[corners[3]]))
+    return;
+    /* Other meshes are filled all at once, through their outline. */
+  if (!sampled && !mesh.Outline().empty())
+  {
+    FillPolygonEdges(raster, &mesh.mTempVerts[0], &mesh.Outline()[0],
+                     static_cast<int>(mesh.Outline().size() / 2), eNonZero,
+                     DirtyRect(0, 0, raster.Width(), raster.Height()));
+    return;
+  }
     /* Loop through each face of the current object. */
   for (int i = 0; i < mesh.FaceCount(); ++i)
   {
@@ -692,12 +1594,104 @@ void RasterFaces(Raster &raster, Object &object)
     sClipVerts.push_back(R);
       /* If we clipped any of the object to the viewport. */
     if (gCameras.ClipToScreen(sClipVerts))
+    {
         /* Draw each new face that resulted from the clipping. */
       for (unsigned int j = 1; j < sClipVerts.size() - 1; ++j)
-        FillTriangle(raster, sClipVerts[0], sClipVerts[j], sClipVerts[j + 1]);
+        if (sampled)
+          FillMultisampledTriangle(raster, sClipVerts[0], sClipVerts[j], sClipVerts[j + 1],
+                                   object.mFaceColor);
+        else
+          FillTriangle(raster, sClipVerts[0], sClipVerts[j], sClipVerts[j + 1]);
+    }
   }
 }
 
+/*!
+******************************************************************************
+  \fn bool FindQuad(MyMesh &mesh, int corners[4])
+
+  \brief
+    Find whether the given mesh is a quad: two faces, ABC and ACD.
+
+  \param mesh
+    The mesh to check.
+
+  \param corners
+    Where to store the indices of the quad's corners (A, B, C and D).
+
+  \return
+    Whether the mesh is a quad.
+*******************************************************************************/
+bool FindQuad(MyMesh &mesh, int corners[4])
+{
+  if (mesh.FaceCount() != 2)
+    return false;
+
+  const Mesh::Face &f0 = mesh.GetFace(0);
+  const Mesh::Face &f1 = mesh.GetFace(1);
+  if ((f0.index1 != f1.index1) || (f0.index3 != f1.index2))
+    return false;
+
+  corners[0] = f0.index1;
+  corners[1] = f0.index2;
+  corners[2] = f0.index3;
+  corners[3] = f1.index3;
+  return true;
+}
+
+/*!
+******************************************************************************
+  \fn bool RasterOutlined(Raster &raster, Object &object, const Color &color)
+
+  \brief
+    Fill and outline the object in one pass over its scanlines (see
+    FillOutlinedQuad), if it is an opaque, flat quad whose edges all run
+    along its sides, and drawn aliased without multisampling.
+
+  \param raster
+    The Raster object that the object will be drawn to.
+
+  \param object
+    The object to be rasterized.
+
+  \param color
+    The color to draw the edges in.
+
+  \return
+    Whether the object was drawn.
+*******************************************************************************/
+bool RasterOutlined(Raster &raster, Object &object, const Color &color)
+{
+  MyMesh &mesh = object.GetMesh();
+  int     corners[4];
+  if ((object.mFaceAlpha != gOpaqueAlpha) || gRenderOptions.mSmoothLines ||
+      raster.GetSamples() || mesh.mpTexture || !mesh.mVertColors.empty() ||
+      !FindQuad(mesh, corners))
+    return false;
+
+    /* Flag the sides the edges run along (any other edge leaves it to the usual path). */
+  unsigned outlined = 0;
+  for (int i = 0; i < mesh.EdgeCount(); ++i)
+  {
+    const Mesh::Edge &e    = mesh.GetEdge(i);
+    int               side = 0;
+    while ((side < 4) &&
+           !((e.index1 == corners[side]) && (e.index2 == corners[(side + 1) & 3])) &&
+           !((e.index2 == corners[side]) && (e.index1 == corners[(side + 1) & 3])))
+      ++side;
+    if (side == 4)
+      return false;
+    outlined |= (1u << side);
+  }
+
+  return FillOutlinedQuad(raster,
+                          mesh.mTempVerts[corners[0]],
+                          mesh.mTempVerts[corners[1]],
+                          mesh.mTempVerts[corners[2]],
+                          mesh.mTempVerts[corners[3]],
+                          outlined, 0.5f, object.mFaceColor, color);
+}
+
 /*!
 ******************************************************************************
   \fn void RasterEdges(Raster &raster, const Object &object)
@@ -711,14 +1705,40 @@ void RasterFaces(Raster &raster, Object &object)
 
   \param object
     The object to be rasterized.
+
+  \param color
+    The color to draw the edges in.
+
+  \param pStroke
+    The style to stroke the edges in (NULL draws them as lines).
 *******************************************************************************/
-void RasterEdges(Raster &raster, Object &object, Color color)
+void RasterEdges(Raster &raster, Object &object, Color color, const StrokeStyle *pStroke)
 {
+    /* The object's edges as pairs of vertex indices, for stroking them. */
+  static std::vector<int> sEdgeIndices;
+
     /* Get a reference to the MyMesh that this object is made of. */
   MyMesh &mesh = object.GetMesh();
 
+    /* Blended pixels cannot claim coverage, so only smooth lines without it. */
+  const bool smooth = (gRenderOptions.mSmoothLines && !raster.GetCoverage());
+
     /* Set the drawing color to the color of the edge of the current object. */
   raster.SetColor(color.red, color.grn, color.blu);
+    /* Wide edges are stroked whole, clipped to the screen pixel by pixel. */
+  if (pStroke)
+  {
+    sEdgeIndices.clear();
+    for (int i = 0; i < mesh.EdgeCount(); ++i)
+    {
+      sEdgeIndices.push_back(mesh.GetEdge(i).index1);
+      sEdgeIndices.push_back(mesh.GetEdge(i).index2);
+    }
+    if (!sEdgeIndices.empty())
+      DrawEdgeStrokes(raster, &mesh.mTempVerts[0], &sEdgeIndices[0], mesh.EdgeCount(),
+                      *pStroke, DirtyRect(0, 0, raster.Width(), raster.Height()));
+    return;
+  }
     /* Loop through each edge of the current object. */
   for (int i = 0; i < mesh.EdgeCount(); ++i)
   {
@@ -728,6 +1748,102 @@ void RasterEdges(Raster &raster, Object &object, Color color)
     Point Q             = mesh.mTempVerts[e.index2];
       /* If we clipped any of the object's current edge to the viewport draw it. */
     if (gCameras.ClipToScreen(P, Q))
-      DrawLine(raster, P, Q);
+    {
+      if (smooth)
+        DrawSmoothLine(raster, P, Q);
+      else
+        DrawLine(raster, P, Q);
+    }
   }
 }
+
+/*!
+******************************************************************************
+  \fn void SetSceneConfig(const SceneConfig &config)
+
+  \brief
+    Set the configuration used by the following calls to InitFrame().
+
+  \param config
+    The configuration to use.
+*******************************************************************************/
+void SetSceneConfig(const SceneConfig &config)
+{
+  gSceneConfig = config;
+}
+
+/*!
+******************************************************************************
+  \fn const SceneConfig &GetSceneConfig(void)
+
+  \brief
+    Get the configuration currently in use.
+
+  \return
+    A reference to the configuration currently in use.
+*******************************************************************************/
+const SceneConfig &GetSceneConfig(void)
+{
+  return gSceneConfig;
+}
+
+/*!
+******************************************************************************
+  \fn const SceneStats &GetSceneStats(void)
+
+  \brief
+    Get the measurements taken while generating the scene.
+
+  \return
+    A reference to the measurements taken while generating the scene.
+*******************************************************************************/
+const SceneStats &GetSceneStats(void)
+{
+  return gSceneStats;
+}
+
+/*!
+******************************************************************************
+  \fn void SetRenderOptions(const RenderOptions &options)
+
+  \brief
+    Set the options used by the following calls to InitFrame()/DrawFrame().
+
+  \param options
+    The options to use.
+*******************************************************************************/
+void SetRenderOptions(const RenderOptions &options)
+{
+  gRenderOptions = options;
+  gDynamicTexture.SetBilinear(gRenderOptions.mBilinearTextures);
+}
+
+/*!
+******************************************************************************
+  \fn const RenderOptions &GetRenderOptions(void)
+
+  \brief
+    Get the options currently in use.
+
+  \return
+    A reference to the options currently in use.
+*******************************************************************************/
+const RenderOptions &GetRenderOptions(void)
+{
+  return gRenderOptions;
+}
+
+/*!
+******************************************************************************
+  \fn const FrameStats &GetFrameStats(void)
+
+  \brief
+    Get the statistics gathered while drawing the last frame.
+
+  \return
+    A reference to the statistics of the last frame.
+*******************************************************************************/
+const FrameStats &GetFrameStats(void)
+{
+  return gFrameStats;
+}
@@ -13,6 +13,8 @@
 
 *******************************************************************************/
 #include "RasterUtilities.h"
+#include "ClippedLine.h"
+#include <algorithm>
 
   /* Typedef the pointer-to-member-function needed to call (In/De)crementX. */
 typedef void (Raster::*RasterIterator)(void);
@@ -29,6 +31,9 @@ inline
 int MyRound(float f) { return static_cast<int>(f + 0.5f); }
   /* Draw a line that is vertical (undefined). */
 static void DrawUndefinedLine(Raster &raster, const Point &pt_P, const Point &pt_Q);
+  /* Draw the part of a line that is vertical (undefined) inside a rectangle. */
+static void DrawUndefinedClippedLine(Raster &raster, const Point &pt_P, const Point &pt_Q,
+                                     int x0, int y0, int x1, int y1);
 
   /* 
    * Union of float and unsigned int so that we can do 
@@ -73,6 +78,12 @@ typedef struct
   void InitLinePoints(float d_min, float d_max, float r_min);
     /* Rasterize the line to the Raster object. */
   void Rasterize(Raster &raster);
+    /* 
+     * Rasterize the pixels of the line inside [x0, x1) x [y0, y1) to the 
+     * Raster object, the domain running along the x-axis if [x_domain] is 
+     * set (and along the y-axis otherwise). 
+     */
+  void RasterizeClipped(Raster &raster, bool x_domain, int x0, int y0, int x1, int y1);
 } LineSegment;
 
   /*
@@ -138,6 +149,44 @@ void LineSegment::Rasterize(Raster &raster)
   }
 }
 
+  /*
+   * Rasterize the pixels of the line inside the rectangle, stepping a cursor 
+   * the same way Rasterize steps the Raster object's and only moving the 
+   * Raster object's there to write them. 
+   */
+void LineSegment::RasterizeClipped(Raster &raster, bool x_domain,
+                                   int x0, int y0, int x1, int y1)
+{
+  int domain     = domain_min;
+  int range      = range_int;
+  int range_step = ((slope >= 0.0f) ? 1 : -1);
+    /* The rectangle along the domain and the range. */
+  int d_min      = (x_domain ? x0 : y0);
+  int d_max      = (x_domain ? x1 : y1);
+  int r_min      = (x_domain ? y0 : x0);
+  int r_max      = (x_domain ? y1 : x1);
+
+    /* For each pixel on the domain of this line... */
+  while ((domain_min++) <= domain_max)
+  {
+    if ((d_min <= domain) && (domain < d_max) &&
+        (r_min <= range)  && (range  < r_max))
+    {
+      if (x_domain)                      /* Draw the pixel if it is in the */
+        raster.GotoPoint(domain, range); /* rectangle.                     */
+      else
+        raster.GotoPoint(range, domain);
+      raster.WritePixel();
+    }
+    range_old    = range_int;            /* Save the current range value.  */
+    range_float += slope;                /* Increment the actual value.    */
+    range_int    = MyRound(range_float); /* Get the integer (pixel) value. */
+    if (range_old != range_int)          /* If the integer value changed,  */
+      range += range_step;               /* Iterate the cursor.            */
+    ++domain;                            /* Iterate to the next pixel.     */
+  }
+}
+
 /*
  * This function will scan convert the line segment from point P to point Q in
  * screen coordinates. Note that unlike the FillRect and DrawRect functions in
@@ -241,3 +290,64 @@ void DrawUndefinedLine(Raster &raster, const Point &pt_P, const Point &pt_Q)
     raster.IncrementY();
   }
 }
+
+/*
+ * Draw the pixels DrawLine would write for the line segment from P to Q that 
+ * lie in the rectangle [x0, x1) x [y0, y1). The setup mirrors DrawLine 
+ * exactly so that the two always agree on which pixels make up a line.
+ */
+void DrawClippedLine(Raster &raster, const Point &pt_P, const Point &pt_Q,
+                     int x0, int y0, int x1, int y1)
+{
+  LineSegment line;
+  Slope       slope_magnitude;
+
+  if (!line.InitSlope(pt_P, pt_Q))
+  {
+    DrawUndefinedClippedLine(raster, pt_P, pt_Q, x0, y0, x1, y1);
+    return;
+  }
+
+  slope_magnitude.m    = line.slope;
+  slope_magnitude.abs &= ABS_MASK;
+  
+    /* If (|m| <= 1), then scan with respect to the x-axis. */
+  if (slope_magnitude.m <= 1.0f)
+  {
+    if (pt_P.x < pt_Q.x)
+      line.InitLinePoints(pt_P.x, pt_Q.x, pt_P.y);
+    else
+      line.InitLinePoints(pt_Q.x, pt_P.x, pt_Q.y);
+    line.RasterizeClipped(raster, true, x0, y0, x1, y1);
+  }
+  else /* Otherwise, scan with respect to the y-axis. */
+  {
+    line.slope = (1.0f / line.slope);    
+    if (pt_P.y < pt_Q.y)
+      line.InitLinePoints(pt_P.y, pt_Q.y, pt_P.x);
+    else
+      line.InitLinePoints(pt_Q.y, pt_P.y, pt_Q.x);
+    line.RasterizeClipped(raster, false, x0, y0, x1, y1);
+  }
+}
+
+  /*
+   * Given two points known to be undefined in cartesian coordinates, draw 
+   * the pixels DrawUndefinedLine would write that lie in the rectangle.
+   */
+void DrawUndefinedClippedLine(Raster &raster, const Point &pt_P, const Point &pt_Q,
+                              int x0, int y0, int x1, int y1)
+{
+  int x    = MyRound(pt_P.x);
+  int yMin = std::max(MyRound(std::min(pt_P.y, pt_Q.y)), y0);
+  int yMax = std::min(MyRound(std::max(pt_P.y, pt_Q.y)), (y1 - 1));
+
+  if ((x < x0) || (x >= x1) || (yMin > yMax))
+    return;
+  raster.GotoPoint(x, yMin);
+  for (/* length = length */; yMin <= yMax; ++yMin)
+  {
+    raster.WritePixel();
+    raster.IncrementY();
+  }
+}
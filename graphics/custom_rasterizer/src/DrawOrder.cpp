@@ -0,0 +1,148 @@
+/*!
+*****************************************************************************
+\file   DrawOrder.cpp
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the implementation of SortDrawOrder.
+
+  Finding every earlier draw that overlaps a draw would take quadratic time,
+  so the screen is split into cells that remember the highest layer drawn
+  into them so far. A draw's layer is one above the highest layer of the
+  cells its bounds touch, which may put a draw above one it does not quite
+  overlap (costing a bit of freedom), but never below one it does.
+*******************************************************************************/
+#include "DrawOrder.h"
+#include <algorithm>
+#include <cstdint>
+
+
+/*############################################################################*/
+/*############################# Global Constants #############################*/
+/*############################################################################*/
+
+  /* Size (in pixels, as a power of 2) of the cells tracking the layers. */
+static const int gCellShift = 5;
+
+
+/*############################################################################*/
+/*############################### Global Data ################################*/
+/*############################################################################*/
+
+  /* The highest layer drawn into each cell so far. */
+static std::vector<int>           sCellLayers;
+  /* The (layer, Morton code) sort key of each draw. */
+static std::vector<std::uint64_t> sKeys;
+
+
+/*############################################################################*/
+/*########################## Local Helper Functions ##########################*/
+/*############################################################################*/
+
+  /* Spread the low 16 bits of [value] out to the even bits. */
+static std::uint32_t SpreadBits(std::uint32_t value)
+{
+  value &= 0x0000FFFF;
+  value  = ((value | (value << 8)) & 0x00FF00FF);
+  value  = ((value | (value << 4)) & 0x0F0F0F0F);
+  value  = ((value | (value << 2)) & 0x33333333);
+  value  = ((value | (value << 1)) & 0x55555555);
+  return value;
+}
+
+  /* Get the Morton (Z-order) code of pixel (x, y). */
+static std::uint32_t MortonCode(int x, int y)
+{
+  return (SpreadBits(static_cast<std::uint32_t>(x)) |
+          (SpreadBits(static_cast<std::uint32_t>(y)) << 1));
+}
+
+
+/*############################################################################*/
+/*######################### Function Implementation ##########################*/
+/*############################################################################*/
+
+/*!
+******************************************************************************
+  \fn int SortDrawOrder(const DirtyRect *pBounds, int count, int width,
+                        int height, std::vector<int> &order)
+
+  \brief
+    Sort draws by screen locality while keeping overlapping draws in order.
+
+  \param pBounds
+    The pixels each draw may touch (empty for draws that touch none).
+
+  \param count
+    The number of draws.
+
+  \param width
+    The width of the screen.
+
+  \param height
+    The height of the screen.
+
+  \param order
+    Receives the indices of the draws, in the order they should be drawn.
+
+  \return
+    The number of layers the draws were split into.
+*******************************************************************************/
+int SortDrawOrder(const DirtyRect      *pBounds,
+                        int             count,
+                        int             width,
+                        int             height,
+                        std::vector<int> &order)
+{
+  const int cellsX = (((width  - 1) >> gCellShift) + 1);
+  const int cellsY = (((height - 1) >> gCellShift) + 1);
+  int       layers = 0;
+
+  sCellLayers.assign(static_cast<std::size_t>(cellsX) * cellsY, 0);
+  sKeys.resize(count);
+  order.resize(count);
+
+  for (int i = 0; i < count; ++i)
+  {
+    const DirtyRect &bounds = pBounds[i];
+    order[i] = i;
+      /* Draws that touch no pixels can go anywhere. */
+    if (bounds.IsEmpty())
+    {
+      sKeys[i] = 0;
+      continue;
+    }
+
+    const int x0 = (bounds.mX0 >> gCellShift);
+    const int y0 = (bounds.mY0 >> gCellShift);
+    const int x1 = ((bounds.mX1 - 1) >> gCellShift);
+    const int y1 = ((bounds.mY1 - 1) >> gCellShift);
+
+      /* Go above every earlier draw sharing a cell... */
+    int layer = 0;
+    for (int y = y0; y <= y1; ++y)
+      for (int x = x0; x <= x1; ++x)
+        layer = std::max(layer, sCellLayers[(y * cellsX) + x]);
+      /* ...and claim those cells for this layer. */
+    for (int y = y0; y <= y1; ++y)
+      for (int x = x0; x <= x1; ++x)
+        sCellLayers[(y * cellsX) + x] = (layer + 1);
+    layers = std::max(layers, (layer + 1));
+
+    sKeys[i] = ((static_cast<std::uint64_t>(layer) << 32) |
+                MortonCode(((bounds.mX0 + bounds.mX1) / 2),
+                           ((bounds.mY0 + bounds.mY1) / 2)));
+  }
+
+    /* Equal keys keep their submission order. */
+  std::stable_sort(order.begin(), order.end(),
+                   [] (int a, int b)
+                   { return (sKeys[a] < sKeys[b]); });
+
+  return layers;
+}
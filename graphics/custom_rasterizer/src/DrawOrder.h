@@ -0,0 +1,44 @@
+/*!
+*****************************************************************************
+\file   DrawOrder.h
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the prototype of SortDrawOrder, which reorders draws so
+  that consecutive ones touch nearby parts of the frame buffer.
+*******************************************************************************/
+#ifndef DRAWORDER_H
+#define DRAWORDER_H
+
+#include "DamageTracker.h"
+#include <vector>
+
+
+/*############################################################################*/
+/*########################### Function Prototypes ############################*/
+/*############################################################################*/
+
+  /*
+   * Fill [order] with the indices of [count] draws, whose pixels lie within
+   * [pBounds] on a [width] x [height] screen, sorted so that consecutive
+   * draws land close together on screen (by the Morton code of the center of
+   * their bounds) without changing how overlapping draws cover each other.
+   * Each draw is given a layer one above the highest layer of the earlier
+   * draws it may overlap, and draws are sorted by layer first, so any two
+   * draws that may overlap keep their order while the draws within a layer
+   * (which never overlap) are free to move. Returns the number of layers.
+   */
+int SortDrawOrder(const DirtyRect      *pBounds,
+                        int             count,
+                        int             width,
+                        int             height,
+                        std::vector<int> &order);
+
+
+#endif
+
@@ -0,0 +1,398 @@
+/*!
+*****************************************************************************
+\file   Ellipse.cpp
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the implementation of the ellipse and arc primitives.
+
+  A quarter of the ellipse's edge is traced once with the integer midpoint
+  algorithm (stepping across in x while the edge is flatter than 45 degrees,
+  then down in y), noting the first and last pixel it lands on in each
+  scanline. The other quarters are mirror images, so every scanline of the
+  ellipse is then written straight from that table: a single span across
+  when filling, or the run of edge pixels on either side when drawing.
+  Arcs narrow each of those spans to the pixels between their two rays,
+  found in integers from the rays' directions, so no pixel is tested (or
+  written) on its own.
+*******************************************************************************/
+#include "Ellipse.h"
+#include "FixedPoint.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+
+/*############################################################################*/
+/*############################# Global Constants #############################*/
+/*############################################################################*/
+
+  /*
+   * The largest radius traced; beyond it, the decision variables (up to
+   * 4 * rx^2 * ry^2) no longer fit in 64 bits.
+   */
+static const int   gMaxRadius = 32767;
+  /* Number of fractional bits in the (fixed point) directions of an arc's rays. */
+static const int   gRayBits   = 16;
+  /* Pre-calculate two pi. */
+static const float gTwoPI     = (8.0f * std::atan(1.0f));
+
+
+/*############################################################################*/
+/*########################## Local Helper Functions ##########################*/
+/*############################################################################*/
+
+  /* An inclusive range of pixels [mX0, mX1] (relative to the center). */
+struct PixelRun
+{
+  int mX0;
+  int mX1;
+};
+
+  /* The rays bounding an arc, and how the pixels between them are found. */
+struct ArcRays
+{
+    /* The direction of each ray. */
+  Fixed mStartX, mStartY;
+  Fixed mEndX,   mEndY;
+    /*
+     * Whether the arc spans more than half a turn, in which case its pixels
+     * are those on the inner side of either ray, rather than of both.
+     */
+  bool  mReflex;
+};
+
+  /*
+   * The first and last pixel of the ellipse's edge in each scanline of its
+   * lower right quarter (indexed by distance from the center).
+   */
+static std::vector<int> sEdgeFirst;
+static std::vector<int> sEdgeLast;
+
+  /* Note that the trace landed on pixel ([x], [y]). */
+inline
+void Plot(int x, int y)
+{
+  if (sEdgeFirst[y] < 0)
+    sEdgeFirst[y] = x;
+  sEdgeLast[y] = x;
+}
+
+  /*
+   * Trace a quarter of the edge of the ellipse with radii [rx] and [ry] with
+   * the midpoint algorithm, from (0, [ry]) to ([rx], 0), into sEdgeFirst and
+   * sEdgeLast. Each decision variable is four times the ellipse's implicit
+   * function at the midpoint between the two candidate pixels, which keeps
+   * every step in integers.
+   */
+static void TraceQuadrant(int rx, int ry)
+{
+  sEdgeFirst.assign((ry + 1), -1);
+  sEdgeLast.assign((ry + 1), 0);
+    /* A flat ellipse is a single scanline. */
+  if (!ry)
+  {
+    Plot(0, 0);
+    Plot(rx, 0);
+    return;
+  }
+
+  const Fixed a2 = (static_cast<Fixed>(rx) * rx);
+  const Fixed b2 = (static_cast<Fixed>(ry) * ry);
+  int         x  = 0;
+  int         y  = ry;
+
+    /* Across, deciding between (x + 1, y) and (x + 1, y - 1). */
+  Fixed d = ((4 * b2) - (4 * a2 * ry) + a2);
+  while ((b2 * x) < (a2 * y))
+  {
+    Plot(x, y);
+    if (d < 0)
+      d += (4 * b2 * ((2 * x) + 3));
+    else
+    {
+      d += ((4 * b2 * ((2 * x) + 3)) + (4 * a2 * (2 - (2 * y))));
+      --y;
+    }
+    ++x;
+  }
+
+    /* Down, deciding between (x, y - 1) and (x + 1, y - 1). */
+  d = ((b2 * ((2 * x) + 1) * ((2 * x) + 1)) + (4 * a2 * (y - 1) * static_cast<Fixed>(y - 1)) -
+       (4 * a2 * b2));
+  while (0 <= y)
+  {
+    Plot(x, y);
+    if (0 < d)
+      d += (4 * a2 * (3 - (2 * y)));
+    else
+    {
+      d += ((4 * b2 * ((2 * x) + 2)) + (4 * a2 * (3 - (2 * y))));
+      ++x;
+    }
+    --y;
+  }
+}
+
+  /* Set up the rays of the arc from [startAngle] to [endAngle]. */
+static ArcRays MakeArcRays(float startAngle, float endAngle)
+{
+  float sweep = std::fmod((endAngle - startAngle), gTwoPI);
+  if (sweep < 0.0f)
+    sweep += gTwoPI;
+
+  const float scale = static_cast<float>(1 << gRayBits);
+  ArcRays     rays;
+  rays.mStartX = static_cast<Fixed>(std::floor((std::cos(startAngle) * scale) + 0.5f));
+  rays.mStartY = static_cast<Fixed>(std::floor((std::sin(startAngle) * scale) + 0.5f));
+  rays.mEndX   = static_cast<Fixed>(std::floor((std::cos(endAngle)   * scale) + 0.5f));
+  rays.mEndY   = static_cast<Fixed>(std::floor((std::sin(endAngle)   * scale) + 0.5f));
+  rays.mReflex = ((0.5f * gTwoPI) < sweep);
+  return rays;
+}
+
+  /*
+   * Find the pixels of scanline [dy] (relative to the center) within
+   * [xMin, xMax] that lie between the arc's rays, as up to two runs (in
+   * order, apart). Returns the number of runs.
+   */
+static int ArcRuns(const ArcRays &rays, int dy, int xMin, int xMax, PixelRun pRuns[2])
+{
+    /* The pixels on the inner side of the start ray: cross(start, P) >= 0. */
+  PixelRun start = { xMin, xMax };
+  if (0 < rays.mStartY)
+    start.mX1 = static_cast<int>(std::min<Fixed>(start.mX1, FloorDiv((rays.mStartX * dy), rays.mStartY)));
+  else if (rays.mStartY < 0)
+    start.mX0 = static_cast<int>(std::max<Fixed>(start.mX0, CeilDiv((rays.mStartX * dy), rays.mStartY)));
+  else if ((rays.mStartX * dy) < 0)
+    start.mX1 = (start.mX0 - 1);
+
+    /* The pixels on the inner side of the end ray: cross(P, end) >= 0. */
+  PixelRun end = { xMin, xMax };
+  if (0 < rays.mEndY)
+    end.mX0 = static_cast<int>(std::max<Fixed>(end.mX0, CeilDiv((rays.mEndX * dy), rays.mEndY)));
+  else if (rays.mEndY < 0)
+    end.mX1 = static_cast<int>(std::min<Fixed>(end.mX1, FloorDiv((rays.mEndX * dy), rays.mEndY)));
+  else if (0 < (rays.mEndX * dy))
+    end.mX1 = (end.mX0 - 1);
+
+  if (!rays.mReflex)
+  {
+    pRuns[0].mX0 = std::max(start.mX0, end.mX0);
+    pRuns[0].mX1 = std::min(start.mX1, end.mX1);
+    return ((pRuns[0].mX0 <= pRuns[0].mX1) ? 1 : 0);
+  }
+
+    /* Either side will do: merge the two runs unless they are apart. */
+  int count = 0;
+  if (start.mX0 <= start.mX1)
+    pRuns[count++] = start;
+  if (end.mX0 <= end.mX1)
+    pRuns[count++] = end;
+  if (count < 2)
+    return count;
+  if (pRuns[1].mX0 < pRuns[0].mX0)
+    std::swap(pRuns[0], pRuns[1]);
+  if ((pRuns[1].mX0 - 1) <= pRuns[0].mX1)
+  {
+    pRuns[0].mX1 = std::max(pRuns[0].mX1, pRuns[1].mX1);
+    return 1;
+  }
+  return 2;
+}
+
+  /*
+   * Fill ([outline] false) or draw the edge of the ellipse centered on
+   * ([cx], [cy]) with radii [rx] and [ry], restricted to the arc between
+   * [pRays] when given, writing only the pixels in [clipRect].
+   */
+static void RasterEllipse(Raster &raster, int cx, int cy, int rx, int ry, bool outline,
+                          const ArcRays *pRays, const DirtyRect &clipRect)
+{
+  if ((rx < 0) || (ry < 0) || (gMaxRadius < rx) || (gMaxRadius < ry) || clipRect.IsEmpty())
+    return;
+
+    /* Only the scanlines (and pixels) in the clip rectangle, relative to the center. */
+  const int dyMin = std::max(-ry, (clipRect.mY0 - cy));
+  const int dyMax = std::min( ry, (clipRect.mY1 - 1 - cy));
+  const int xMin  = (clipRect.mX0 - cx);
+  const int xMax  = (clipRect.mX1 - 1 - cx);
+  if ((dyMax < dyMin) || (xMax < -rx) || (rx < xMin))
+    return;
+
+  TraceQuadrant(rx, ry);
+  for (int dy = dyMin; dy <= dyMax; ++dy)
+  {
+      /* The pixels of the ellipse in this scanline. */
+    const int last  = sEdgeLast [std::abs(dy)];
+    const int first = (outline ? sEdgeFirst[std::abs(dy)] : 0);
+    PixelRun  runs[2];
+    int       runCount = 0;
+    if (first)
+    {
+      runs[runCount].mX0   = -last;
+      runs[runCount++].mX1 = -first;
+      runs[runCount].mX0   = first;
+      runs[runCount++].mX1 = last;
+    }
+    else
+    {
+      runs[runCount].mX0   = -last;
+      runs[runCount++].mX1 = last;
+    }
+
+      /* The pixels of the clip rectangle (and arc) in this scanline. */
+    PixelRun spans[2] = { { xMin, xMax } };
+    int      spanCount = (pRays ? ArcRuns(*pRays, dy, xMin, xMax, spans) : 1);
+
+      /* Both sets of runs are in order and apart, so no pixel is written twice. */
+    for (int i = 0; i < runCount; ++i)
+      for (int j = 0; j < spanCount; ++j)
+      {
+        const int x0 = std::max(runs[i].mX0, spans[j].mX0);
+        const int x1 = std::min(runs[i].mX1, spans[j].mX1);
+        if (x1 < x0)
+          continue;
+        raster.GotoPoint((cx + x0), (cy + dy));
+        raster.WriteSpan(x1 - x0 + 1);
+      }
+  }
+}
+
+
+/*############################################################################*/
+/*######################### Function Implementation ##########################*/
+/*############################################################################*/
+
+/*!
+******************************************************************************
+  \fn void FillEllipse(Raster &raster, int cx, int cy, int rx, int ry,
+                       const DirtyRect &clipRect)
+
+  \brief
+    Fill an axis-aligned ellipse, a span per scanline.
+
+  \param raster
+    The Raster object that the ellipse will be drawn to.
+
+  \param cx, cy
+    The pixel at the center of the ellipse.
+
+  \param rx, ry
+    The radii (in pixels) of the ellipse along the x and y axes.
+
+  \param clipRect
+    The pixels that may be drawn to.
+*******************************************************************************/
+void FillEllipse(Raster &raster, int cx, int cy, int rx, int ry, const DirtyRect &clipRect)
+{
+  RasterEllipse(raster, cx, cy, rx, ry, false, NULL, clipRect);
+}
+
+/*!
+******************************************************************************
+  \fn void DrawEllipse(Raster &raster, int cx, int cy, int rx, int ry,
+                       const DirtyRect &clipRect)
+
+  \brief
+    Draw the edge of an axis-aligned ellipse, its runs of pixels in each
+    scanline written as spans.
+
+  \param raster
+    The Raster object that the ellipse will be drawn to.
+
+  \param cx, cy
+    The pixel at the center of the ellipse.
+
+  \param rx, ry
+    The radii (in pixels) of the ellipse along the x and y axes.
+
+  \param clipRect
+    The pixels that may be drawn to.
+*******************************************************************************/
+void DrawEllipse(Raster &raster, int cx, int cy, int rx, int ry, const DirtyRect &clipRect)
+{
+  RasterEllipse(raster, cx, cy, rx, ry, true, NULL, clipRect);
+}
+
+/*!
+******************************************************************************
+  \fn void FillArc(Raster &raster, int cx, int cy, int rx, int ry,
+                   float startAngle, float endAngle,
+                   const DirtyRect &clipRect)
+
+  \brief
+    Fill the slice of an axis-aligned ellipse between two rays from its
+    center.
+
+  \param raster
+    The Raster object that the slice will be drawn to.
+
+  \param cx, cy
+    The pixel at the center of the ellipse.
+
+  \param rx, ry
+    The radii (in pixels) of the ellipse along the x and y axes.
+
+  \param startAngle, endAngle
+    The angles (in radians, from the +x axis towards the +y axis) of the
+    rays the slice runs between, from the first to the second.
+
+  \param clipRect
+    The pixels that may be drawn to.
+*******************************************************************************/
+void FillArc(Raster &raster, int cx, int cy, int rx, int ry,
+             float startAngle, float endAngle, const DirtyRect &clipRect)
+{
+  if (gTwoPI <= (endAngle - startAngle))
+  {
+    RasterEllipse(raster, cx, cy, rx, ry, false, NULL, clipRect);
+    return;
+  }
+  const ArcRays rays = MakeArcRays(startAngle, endAngle);
+  RasterEllipse(raster, cx, cy, rx, ry, false, &rays, clipRect);
+}
+
+/*!
+******************************************************************************
+  \fn void DrawArc(Raster &raster, int cx, int cy, int rx, int ry,
+                   float startAngle, float endAngle,
+                   const DirtyRect &clipRect)
+
+  \brief
+    Draw the part of an axis-aligned ellipse's edge between two rays from
+    its center.
+
+  \param raster
+    The Raster object that the arc will be drawn to.
+
+  \param cx, cy
+    The pixel at the center of the ellipse.
+
+  \param rx, ry
+    The radii (in pixels) of the ellipse along the x and y axes.
+
+  \param startAngle, endAngle
+    The angles (in radians, from the +x axis towards the +y axis) of the
+    rays the arc runs between, from the first to the second.
+
+  \param clipRect
+    The pixels that may be drawn to.
+*******************************************************************************/
+void DrawArc(Raster &raster, int cx, int cy, int rx, int ry,
+             float startAngle, float endAngle, const DirtyRect &clipRect)
+{
+  if (gTwoPI <= (endAngle - startAngle))
+  {
+    RasterEllipse(raster, cx, cy, rx, ry, true, NULL, clipRect);
+    return;
+  }
+  const ArcRays rays = MakeArcRays(startAngle, endAngle);
+  RasterEllipse(raster, cx, cy, rx, ry, true, &rays, clipRect);
+}
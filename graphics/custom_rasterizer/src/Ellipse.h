@@ -0,0 +1,74 @@
+/*!
+*****************************************************************************
+\file   Ellipse.h
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the prototypes of the functions that draw and fill
+  axis-aligned ellipses, circles and elliptical arcs. Radii may be up to
+  32767 pixels (larger ellipses are not drawn).
+*******************************************************************************/
+#ifndef ELLIPSE_H
+#define ELLIPSE_H
+
+#include "DamageTracker.h"
+#include "Raster.h"
+
+
+/*############################################################################*/
+/*########################### Function Prototypes ############################*/
+/*############################################################################*/
+
+  /*
+   * Fill the ellipse centered on pixel ([cx], [cy]) with radii [rx] and [ry]
+   * (in pixels) in the current foreground color, one span per scanline. Its
+   * edge is the curve DrawEllipse() draws. Only the pixels in [clipRect] are
+   * written.
+   */
+void FillEllipse(Raster &raster, int cx, int cy, int rx, int ry, const DirtyRect &clipRect);
+  /*
+   * Draw the edge of the ellipse centered on pixel ([cx], [cy]) with radii
+   * [rx] and [ry] (in pixels) in the current foreground color: the pixels
+   * nearest the curve, traced by the midpoint algorithm, written as a span
+   * or two per scanline. Only the pixels in [clipRect] are written.
+   */
+void DrawEllipse(Raster &raster, int cx, int cy, int rx, int ry, const DirtyRect &clipRect);
+  /*
+   * Fill the slice of the ellipse centered on pixel ([cx], [cy]) with radii
+   * [rx] and [ry] between the rays at [startAngle] and [endAngle] (in
+   * radians, measured from the +x axis towards the +y axis, the slice
+   * running from the first to the second). Only the pixels in [clipRect]
+   * are written.
+   */
+void FillArc(Raster &raster, int cx, int cy, int rx, int ry,
+             float startAngle, float endAngle, const DirtyRect &clipRect);
+  /*
+   * Draw the part of the edge DrawEllipse() draws lying between the rays at
+   * [startAngle] and [endAngle] (as for FillArc()). Only the pixels in
+   * [clipRect] are written.
+   */
+void DrawArc(Raster &raster, int cx, int cy, int rx, int ry,
+             float startAngle, float endAngle, const DirtyRect &clipRect);
+
+
+/*############################################################################*/
+/*############################# Helper Functions #############################*/
+/*############################################################################*/
+
+  /* Fill the circle centered on pixel ([cx], [cy]) with radius [r]. */
+inline
+void FillCircle(Raster &raster, int cx, int cy, int r, const DirtyRect &clipRect)
+{ FillEllipse(raster, cx, cy, r, r, clipRect); }
+
+  /* Draw the edge of the circle centered on pixel ([cx], [cy]) with radius [r]. */
+inline
+void DrawCircle(Raster &raster, int cx, int cy, int r, const DirtyRect &clipRect)
+{ DrawEllipse(raster, cx, cy, r, r, clipRect); }
+
+
+#endif
@@ -0,0 +1,84 @@
+/*!
+*****************************************************************************
+\file   FixedPoint.h
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the 32.32 fixed point helpers shared by the passes that
+  walk a scanline through a (device-to-something) affine mapping one pixel
+  at a time, e.g. the procedural background and its reprojection.
+*******************************************************************************/
+#ifndef FIXEDPOINT_H
+#define FIXEDPOINT_H
+
+#include <algorithm>
+
+
+/*############################################################################*/
+/*############################# Global Constants #############################*/
+/*############################################################################*/
+
+  /* Short-hand typedef for the 32.32 fixed point values. */
+typedef long long Fixed;
+
+  /* Number of fractional bits in the fixed point values. */
+static const int   gFracBits = 32;
+  /* 1.0 in fixed point. */
+static const Fixed gFixedOne = (static_cast<Fixed>(1) << gFracBits);
+
+
+/*############################################################################*/
+/*############################# Helper Functions #############################*/
+/*############################################################################*/
+
+  /* Convert a float to fixed point (rounding to nearest). */
+inline
+Fixed ToFixed(double value)
+{ return static_cast<Fixed>((value * gFixedOne) + ((value < 0.0) ? -0.5 : 0.5)); }
+
+  /* Integer division rounding towards negative infinity. */
+inline
+Fixed FloorDiv(Fixed a, Fixed b)
+{
+  Fixed q = (a / b);
+  return ((((a % b) != 0) && ((a < 0) != (b < 0))) ? (q - 1) : q);
+}
+
+  /* Integer division rounding towards positive infinity. */
+inline
+Fixed CeilDiv(Fixed a, Fixed b)
+{ return -FloorDiv(-a, b); }
+
+  /*
+   * Narrow [xMin, xMax] to the pixels x for which the coordinate
+   * (start + (step * x)) lies within [0, limit).
+   */
+inline
+void ClampToRange(Fixed start, Fixed step, Fixed limit, Fixed &xMin, Fixed &xMax)
+{
+  if (step == 0)
+  {
+    if ((start < 0) || (limit <= start))
+      xMax = (xMin - 1);
+    return;
+  }
+  if (step > 0)
+  {
+    xMin = std::max(xMin, CeilDiv (-start,               step));
+    xMax = std::min(xMax, FloorDiv((limit - 1 - start),  step));
+  }
+  else
+  {
+    xMin = std::max(xMin, CeilDiv ((limit - 1 - start),  step));
+    xMax = std::min(xMax, FloorDiv(-start,               step));
+  }
+}
+
+
+#endif
+
@@ -0,0 +1,330 @@
+/*!
+*****************************************************************************
+\file   FrameOptions.h
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the knobs used to configure how DrawFrame renders the
+  scene, as well as the statistics it gathers while doing so. Options should
+  be set before calling InitFrame(), and the statistics are refreshed on every
+  call to DrawFrame().
+*******************************************************************************/
+#ifndef FRAMEOPTIONS_H
+#define FRAMEOPTIONS_H
+
+#include "DamageTracker.h"
+#include "Stroke.h"
+#include <cstddef>
+#include <vector>
+
+
+/*!
+******************************************************************************
+  \struct SceneConfig
+
+  \brief
+    Settings that control how InitFrame() generates the scene.
+*******************************************************************************/
+struct SceneConfig
+{
+    /* Number of dynamic objects to generate. */
+  int      mDynamicObjCount;
+    /*
+     * Number of background tiles along each side of the (square) tile grid
+     * (0 sizes the grid to cover the static camera's viewport).
+     */
+  int      mTileGridSize;
+    /*
+     * Number of dynamic objects grouped under each moving parent node of
+     * the scene graph (1 lets every object move on its own). Grouped objects
+     * keep a fixed offset from their parent, which moves and spins them as
+     * one cluster.
+     */
+  int      mClusterSize;
+    /*
+     * Shade the dynamic objects smoothly, as if lit from the top left,
+     * instead of filling them with a flat color.
+     */
+  bool     mShadedObjects;
+    /*
+     * Cover the dynamic objects in a (mipmapped) brick texture, tinted by
+     * their colors. Takes the place of the shading above.
+     */
+  bool     mTexturedObjects;
+    /*
+     * Seed the scene is generated from; the same seed always produces the
+     * same scene (0 picks a seed from the current time).
+     */
+  unsigned mSeed;
+
+    /* Default constructor. */
+  SceneConfig(void)
+    : mDynamicObjCount(50), mTileGridSize(0), mClusterSize(1),
+      mShadedObjects(false), mTexturedObjects(false), mSeed(0) { ; }
+};
+
+/*!
+******************************************************************************
+  \struct SceneStats
+
+  \brief
+    Measurements taken while InitFrame() generated the scene.
+*******************************************************************************/
+struct SceneStats
+{
+    /* The seed the scene was actually generated from. */
+  unsigned    mSeed;
+    /* Number of dynamic objects/background tiles that were generated. */
+  std::size_t mDynamicObjCount;
+  std::size_t mTileCount;
+    /* Wall time (in milliseconds) taken to generate the scene. */
+  double      mGenerateMs;
+    /*
+     * Memory (in bytes) used by each dynamic object/background tile,
+     * including the storage reserved for its transformed vertices.
+     */
+  std::size_t mBytesPerDynamicObj;
+  std::size_t mBytesPerTile;
+    /*
+     * Memory (in bytes) the data of the mesh shared by the dynamic objects
+     * takes as authored, and as drawn once optimized and packed.
+     */
+  std::size_t mDynamicMeshBytesBefore;
+  std::size_t mDynamicMeshBytesAfter;
+
+    /* Default constructor. */
+  SceneStats(void)
+    : mSeed(0), mDynamicObjCount(0), mTileCount(0), mGenerateMs(0.0),
+      mBytesPerDynamicObj(0), mBytesPerTile(0), mDynamicMeshBytesBefore(0),
+      mDynamicMeshBytesAfter(0) { ; }
+};
+
+/*!
+******************************************************************************
+  \struct RenderOptions
+
+  \brief
+    Settings that control how each frame is produced.
+*******************************************************************************/
+struct RenderOptions
+{
+    /*
+     * Number of threads used by the parallel update/transform stage
+     * (0 uses one thread per core, 1 runs the stage serially).
+     */
+  int  mWorkerThreads;
+    /*
+     * Draw the background checkerboard with a per-scanline procedural pass
+     * (cost independent of the number of tiles) instead of as Tile objects.
+     * Its borders are drawn as whole grid lines, which plot slightly
+     * different pixels than the Tile objects' edges, so it is off by default.
+     */
+  bool mProceduralBackground;
+    /* Outline the background tiles (Tile objects are always outlined). */
+  bool mTileBorders;
+    /*
+     * Keep a copy of the background once the camera holds still and restore
+     * it with one copy per frame, instead of drawing it again, until the
+     * camera, the tiles or the options above change.
+     */
+  bool mCacheStaticLayer;
+    /*
+     * Only redraw the regions of the screen that changed since the last
+     * frame (while the view holds still and the background is cached). This
+     * relies on the frame buffer still holding the last frame drawn to it.
+     */
+  bool mDamageTracking;
+    /*
+     * While the camera moves, draw the background tiles by warping an earlier
+     * rendering of them into the new view, only drawing the newly exposed
+     * parts from scratch. Tile edges may be off by up to half a pixel
+     * underneath the tile borders.
+     */
+  bool mReprojectBackground;
+    /*
+     * Draw every frame front to back, checking each write against a span
+     * buffer so that every pixel is written exactly once (the background
+     * only filling what is left). Replaces the background cache and damage
+     * tracking above, which rely on the background being drawn first.
+     */
+  bool mFrontToBack;
+    /*
+     * Draw the dynamic objects sorted by where they land on screen (in
+     * Morton order) rather than in submission order, for better frame buffer
+     * locality. Objects that may overlap keep their relative order.
+     */
+  bool mSortDraws;
+    /*
+     * Sample textures by blending the four texels nearest each pixel, rather
+     * than by taking the nearest texel.
+     */
+  bool mBilinearTextures;
+    /*
+     * Number of samples (4 or 8; 0 turns multisampling off) taken per pixel
+     * along the edges of the dynamic objects' flat faces, which are blended
+     * into anti-aliased edges once the objects are drawn. Pixels the faces
+     * cover whole are still written once. Ignored when drawing front to
+     * back, and replaces damage tracking (the edges of the dirty rectangles
+     * would be blended too).
+     */
+  int  mMultisamples;
+    /*
+     * Draw the outlines of the objects (and the dynamic camera's square)
+     * anti-aliased. Ignored when drawing front to back, and replaces damage
+     * tracking (the square is drawn over the dirty rectangles, which would
+     * blend it twice outside of them).
+     */
+  bool mSmoothLines;
+    /*
+     * Opacity (0 to 255) of the dynamic objects, which are blended over what
+     * is behind them unless fully opaque (255). Ignored when drawing front to
+     * back.
+     */
+  int  mObjectAlpha;
+    /*
+     * Opacity (0 to 255) the dynamic camera's square is filled with, in its
+     * edge color (0 leaves it outlined only). Ignored when drawing front to
+     * back, and replaces damage tracking (the square is drawn over the dirty
+     * rectangles, which would blend it twice outside of them).
+     */
+  int  mCamSquareAlpha;
+    /*
+     * How the outlines of the dynamic objects (and the dynamic camera's
+     * square) are drawn. Outlines up to a pixel wide are drawn as lines;
+     * wider ones are stroked with the style's joins and caps, aliased (in
+     * place of smooth lines), each pixel written once.
+     */
+  StrokeStyle mOutlineStroke;
+    /*
+     * How far (in pixels) the dynamic objects may stray from their mesh when
+     * drawn at a simplified level of detail, picked per object per frame by
+     * how big it is on screen (objects under a few pixels across are drawn
+     * as a box or a single pixel in their edge color). 0 always draws the
+     * whole mesh.
+     */
+  float       mLodPixelError;
+    /*
+     * Fill and outline each background tile (when drawn as Tile objects) in
+     * a single pass, giving the pixels within half a pixel of its sides its
+     * edge color as it is filled, instead of filling it and then drawing its
+     * edges over it. Each boundary pixel is clipped and written once, but
+     * the outline is picked by distance rather than stepped like a line, so
+     * it differs from the edges drawn by up to a pixel.
+     */
+  bool        mMergedOutlines;
+
+    /* Default constructor. */
+  RenderOptions(void)
+    : mWorkerThreads(0), mProceduralBackground(false), mTileBorders(true),
+      mCacheStaticLayer(true), mDamageTracking(false),
+      mReprojectBackground(false), mFrontToBack(false), mSortDraws(false),
+      mBilinearTextures(true), mMultisamples(0), mSmoothLines(false),
+      mObjectAlpha(255), mCamSquareAlpha(0), mOutlineStroke(),
+      mLodPixelError(0.0f), mMergedOutlines(false) { ; }
+};
+
+/*!
+******************************************************************************
+  \struct FrameStats
+
+  \brief
+    Timings gathered while drawing the last frame.
+*******************************************************************************/
+struct FrameStats
+{
+    /* Wall time (in milliseconds) spent drawing (or restoring) the background. */
+  double                 mBackgroundMs;
+    /* Whether the background was restored from the cached layer. */
+  bool                   mBackgroundCached;
+    /*
+     * Whether the background was warped from an earlier rendering, and how
+     * many of its pixels still had to be drawn from scratch.
+     */
+  bool                   mBackgroundReprojected;
+  int                    mExposedPixels;
+    /*
+     * Number of pixels cleared before the background tiles were drawn (only
+     * those the tiles were not sure to cover).
+     */
+  int                    mClearedPixels;
+    /* Wall time (in milliseconds) of the update/transform stage. */
+  double                 mTransformMs;
+    /*
+     * Time (in milliseconds) each thread spent updating the dynamic objects,
+     * combining their world transformations with the camera's and
+     * transforming their vertices (the last of which [mTransformMs] leaves
+     * to the raster stage), summed over the three.
+     */
+  std::vector<double>    mTransformThreadMs;
+    /* Number of scene graph world transformations recomputed this frame. */
+  int                    mWorldUpdates;
+    /* Wall time (in milliseconds) spent rasterizing. */
+  double                 mRasterMs;
+    /*
+     * The regions of the frame buffer that changed (the whole screen unless
+     * the frame was drawn incrementally), so only they need to be presented.
+     */
+  std::vector<DirtyRect> mDirtyRects;
+    /* Number of pixels covered by the regions above. */
+  int                    mDirtyPixels;
+    /*
+     * When drawing front to back: the number of pixel writes painting the
+     * frame back to front would have taken, and the number actually made
+     * (their ratios to the screen's area being the overdraw before/after).
+     */
+  int                    mPaintedPixels;
+  int                    mWrittenPixels;
+    /*
+     * Number of layers the dynamic objects were split into when sorting
+     * them (0 when they were drawn in submission order).
+     */
+  int                    mDrawLayers;
+    /*
+     * Number of pixels along the dynamic objects' edges blended from their
+     * samples (0 when multisampling is off).
+     */
+  int                    mResolvedPixels;
+    /*
+     * Number of dynamic objects drawn at each level of detail (the last two
+     * being those drawn as boxes and as single pixels), and the number of
+     * faces and edges they were drawn with (each box or pixel counting as
+     * one). Both are empty/0 when levels of detail are off.
+     */
+  std::vector<int>       mLodObjects;
+  int                    mObjectPrimitives;
+
+    /* Default constructor. */
+  FrameStats(void)
+    : mBackgroundMs(0.0), mBackgroundCached(false),
+      mBackgroundReprojected(false), mExposedPixels(0), mClearedPixels(0),
+      mTransformMs(0.0), mTransformThreadMs(), mWorldUpdates(0), mRasterMs(0.0),
+      mDirtyRects(), mDirtyPixels(0), mPaintedPixels(0), mWrittenPixels(0),
+      mDrawLayers(0), mResolvedPixels(0), mLodObjects(), mObjectPrimitives(0) { ; }
+};
+
+
+/*############################################################################*/
+/*########################### Function Prototypes ############################*/
+/*############################################################################*/
+
+  /* Set the configuration used by the following calls to InitFrame(). */
+void SetSceneConfig(const SceneConfig &config);
+  /* Get the configuration currently in use. */
+const SceneConfig &GetSceneConfig(void);
+  /* Get the measurements taken while generating the scene. */
+const SceneStats &GetSceneStats(void);
+  /* Set the options used by the following calls to InitFrame()/DrawFrame(). */
+void SetRenderOptions(const RenderOptions &options);
+  /* Get the options currently in use. */
+const RenderOptions &GetRenderOptions(void);
+  /* Get the statistics gathered while drawing the last frame. */
+const FrameStats &GetFrameStats(void);
+
+
+#endif
+
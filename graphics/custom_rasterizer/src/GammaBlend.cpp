@@ -0,0 +1,43 @@
+/*!
+*****************************************************************************
+\file   GammaBlend.cpp
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the gamma lookup tables, built once at start up.
+*******************************************************************************/
+#include "GammaBlend.h"
+#include <cmath>
+
+
+/*############################################################################*/
+/*############################### Global Data ################################*/
+/*############################################################################*/
+
+  /* Both lookup tables, filled in by the constructor. */
+static struct GammaTables
+{
+  unsigned short mToLinear[256];
+  unsigned char  mToGamma[1 << gEncodeBits];
+
+    /* Build the tables for gGamma. */
+  GammaTables(void)
+  {
+    const double linearMax = static_cast<double>((1 << gLinearBits) - 1);
+    const double encodeMax = static_cast<double>((1 << gEncodeBits) - 1);
+    for (int i = 0; i < 256; ++i)
+      mToLinear[i] = static_cast<unsigned short>(
+                       (std::pow((i / 255.0), gGamma) * linearMax) + 0.5);
+    for (int i = 0; i < (1 << gEncodeBits); ++i)
+      mToGamma[i] = static_cast<unsigned char>(
+                      (std::pow((i / encodeMax), (1.0 / gGamma)) * 255.0) + 0.5);
+  }
+} sGammaTables;
+
+const unsigned short *const gpToLinear = sGammaTables.mToLinear;
+const unsigned char  *const gpToGamma  = sGammaTables.mToGamma;
@@ -0,0 +1,61 @@
+/*!
+*****************************************************************************
+\file   GammaBlend.h
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the lookup tables between gamma encoded and linear
+  color channels, and BlendChannel, which mixes two channels by a weight in
+  linear light without any floating point.
+*******************************************************************************/
+#ifndef GAMMABLEND_H
+#define GAMMABLEND_H
+
+
+/*############################################################################*/
+/*############################# Global Constants #############################*/
+/*############################################################################*/
+
+  /* The gamma the frame buffer's channels are encoded with. */
+static const double gGamma        = 2.2;
+  /* Number of bits of the linear channel values. */
+static const int    gLinearBits   = 16;
+  /* Number of bits a linear value keeps when encoded back (table size). */
+static const int    gEncodeBits   = 14;
+  /* The weight that selects the new channel entirely. */
+static const int    gFullWeight   = 256;
+
+
+/*############################################################################*/
+/*############################### Global Data ################################*/
+/*############################################################################*/
+
+  /* Each gamma encoded channel value, in linear light (0 to 65535). */
+extern const unsigned short *const gpToLinear;
+  /* Each linear value (its top gEncodeBits bits), gamma encoded. */
+extern const unsigned char  *const gpToGamma;
+
+
+/*############################################################################*/
+/*############################# Helper Functions #############################*/
+/*############################################################################*/
+
+  /*
+   * Mix the gamma encoded channel [src] into [dst] by [weight] / gFullWeight
+   * (within [0, gFullWeight]), in linear light.
+   */
+inline
+unsigned char BlendChannel(unsigned char dst, unsigned char src, int weight)
+{
+  const int d = gpToLinear[dst];
+  const int s = gpToLinear[src];
+  return gpToGamma[(d + (((s - d) * weight) >> 8)) >> (gLinearBits - gEncodeBits)];
+}
+
+
+#endif
@@ -0,0 +1,223 @@
+/*!
+*****************************************************************************
+\file   GouraudFill.cpp
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the implementation of the ColorPlane struct's methods,
+  FillShadedTriangle and TintColor.
+
+  The colors are found in fixed point once per span, then stepped along it
+  once per pixel, so the inner loop is three additions per pixel on top of a
+  flat fill. The colors of a span are linear, so keeping
+  both of its ends within [0, 255] keeps every pixel of it there.
+*******************************************************************************/
+#include "GouraudFill.h"
+#include "FixedPoint.h"
+#include "TriangleSpans.h"
+#include <algorithm>
+#include <cmath>
+
+
+/*############################################################################*/
+/*############################# Global Constants #############################*/
+/*############################################################################*/
+
+  /*
+   * The range of a channel in fixed point: channels are biased by half a
+   * level so that truncating them rounds to the nearest level.
+   */
+static const Fixed gChannelMin = 0;
+static const Fixed gChannelMax = ((static_cast<Fixed>(256) << gFracBits) - 1);
+  /*
+   * The steepest change (per pixel) a triangle is shaded with. Triangles
+   * steeper than this sweep the whole range within a pixel, so they are thin
+   * enough to be filled with the color at their center instead (which also
+   * keeps the fixed point values well within range).
+   */
+static const double gMaxGradient = 256.0;
+
+
+/*############################################################################*/
+/*########################## Local Helper Functions ##########################*/
+/*############################################################################*/
+
+  /*
+   * Find the fixed point colors of the [count] pixels of a span starting at
+   * pixel [x] of a scanline whose colors at x = 0 are [row]: the first
+   * pixel's in [start], and the change per pixel in [step] (the plane's,
+   * [slope], unless the span had to be pulled back in range). Rounding may
+   * leave the edges of a span just out of range, so both of its ends are
+   * kept within it.
+   */
+static void SpanColors(const Fixed row[3],
+                       const Fixed slope[3],
+                             int   x,
+                             int   count,
+                             Fixed start[3],
+                             Fixed step[3])
+{
+  for (int c = 0; c < 3; ++c)
+  {
+    step[c]  = slope[c];
+    start[c] = (row[c] + (slope[c] * x));
+
+    const Fixed end = (start[c] + (slope[c] * (count - 1)));
+    if ((gChannelMin <= std::min(start[c], end)) &&
+        (std::max(start[c], end) <= gChannelMax))
+      continue;
+    start[c] = std::min(std::max(start[c], gChannelMin), gChannelMax);
+    step[c]  = ((count > 1)
+                ? ((std::min(std::max(end, gChannelMin), gChannelMax) - start[c]) / (count - 1))
+                : 0);
+  }
+}
+
+
+/*############################################################################*/
+/*######################### Function Implementation ##########################*/
+/*############################################################################*/
+
+/*!
+******************************************************************************
+  \fn void ColorPlane::Init(const Point &P, const Point &Q, const Point &R,
+                            const Color &cP, const Color &cQ,
+                            const Color &cR)
+
+  \brief
+    Fit the plane through the colors of the corners of a triangle.
+
+  \param P, Q, R
+    The corners of the triangle, in device coordinates.
+
+  \param cP, cQ, cR
+    The colors of the corners.
+*******************************************************************************/
+void ColorPlane::Init(const Point &P, const Point &Q, const Point &R,
+                      const Color &cP, const Color &cQ, const Color &cR)
+{
+  const double ux  = (static_cast<double>(Q.x) - P.x);
+  const double uy  = (static_cast<double>(Q.y) - P.y);
+  const double vx  = (static_cast<double>(R.x) - P.x);
+  const double vy  = (static_cast<double>(R.y) - P.y);
+  const double det = ((ux * vy) - (uy * vx));
+  const double p[3] = { static_cast<double>(cP.red),
+                        static_cast<double>(cP.grn),
+                        static_cast<double>(cP.blu) };
+  const double q[3] = { static_cast<double>(cQ.red),
+                        static_cast<double>(cQ.grn),
+                        static_cast<double>(cQ.blu) };
+  const double r[3] = { static_cast<double>(cR.red),
+                        static_cast<double>(cR.grn),
+                        static_cast<double>(cR.blu) };
+
+  for (int c = 0; c < 3; ++c)
+  {
+    mDx[c] = 0.0;
+    mDy[c] = 0.0;
+    if (det != 0.0)
+    {
+        /* Solve for the change along x/y from the changes along PQ and PR. */
+      const double dq = (q[c] - p[c]);
+      const double dr = (r[c] - p[c]);
+      mDx[c] = (((dq * vy) - (dr * uy)) / det);
+      mDy[c] = (((dr * ux) - (dq * vx)) / det);
+    }
+    mBase[c] = (p[c] - (mDx[c] * P.x) - (mDy[c] * P.y));
+  }
+}
+
+/*!
+******************************************************************************
+  \fn void FillShadedTriangle(Raster &raster, const Point &P,
+                              const Point &Q, const Point &R,
+                              const ColorPlane &plane)
+
+  \brief
+    Fill a triangle, shading it with the given ColorPlane.
+
+  \param raster
+    The Raster object that the triangle will be drawn to.
+
+  \param P, Q, R
+    The corners of the triangle, in device coordinates.
+
+  \param plane
+    The colors of the triangle.
+*******************************************************************************/
+void FillShadedTriangle(      Raster     &raster,
+                        const Point      &P,
+                        const Point      &Q,
+                        const Point      &R,
+                        const ColorPlane &plane)
+{
+    /*
+     * The colors at the device origin (biased by half a level), and their
+     * change per scanline/pixel.
+     */
+  Fixed origin[3];
+  Fixed down[3];
+  Fixed slope[3];
+  bool  steep = false;
+  for (int c = 0; c < 3; ++c)
+    steep = (steep || (std::fabs(plane.mDx[c]) > gMaxGradient) ||
+                      (std::fabs(plane.mDy[c]) > gMaxGradient));
+  for (int c = 0; c < 3; ++c)
+  {
+    double base = plane.mBase[c];
+    double dx   = plane.mDx[c];
+    double dy   = plane.mDy[c];
+    if (steep)
+    {
+      base = std::min(std::max((base + (dx * ((static_cast<double>(P.x) + Q.x + R.x) / 3.0)) +
+                                       (dy * ((static_cast<double>(P.y) + Q.y + R.y) / 3.0))),
+                               0.0), 255.0);
+      dx   = 0.0;
+      dy   = 0.0;
+    }
+    origin[c] = ToFixed(base + 0.5);
+    down[c]   = ToFixed(dy);
+    slope[c]  = ToFixed(dx);
+  }
+
+  ForEachTriangleSpan(P, Q, R,
+                      [&] (int y, int x0, int x1)
+                      {
+                        const Fixed row[3] = { (origin[0] + (down[0] * y)),
+                                               (origin[1] + (down[1] * y)),
+                                               (origin[2] + (down[2] * y)) };
+                        Fixed start[3];
+                        Fixed step[3];
+                        SpanColors(row, slope, x0, (x1 - x0), start, step);
+                        raster.GotoPoint(x0, y);
+                        raster.WriteShadedSpan((x1 - x0), start, step);
+                      } );
+}
+
+/*!
+******************************************************************************
+  \fn Color TintColor(const Color &color, const Color &tint)
+
+  \brief
+    Tint a color, scaling each of its channels by the tint's.
+
+  \param color
+    The color to tint.
+
+  \param tint
+    The tint (white leaving the color unchanged).
+
+  \return
+    The tinted color.
+*******************************************************************************/
+Color TintColor(const Color &color, const Color &tint)
+{
+  return Color(static_cast<Cval>(((color.red * tint.red) + 127) / 255),
+               static_cast<Cval>(((color.grn * tint.grn) + 127) / 255),
+               static_cast<Cval>(((color.blu * tint.blu) + 127) / 255));
+}
@@ -0,0 +1,74 @@
+/*!
+*****************************************************************************
+\file   GouraudFill.h
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the definition of the ColorPlane struct and the
+  prototype of FillShadedTriangle, which fill triangles with colors blended
+  smoothly between their vertices (Gouraud shading).
+*******************************************************************************/
+#ifndef GOURAUDFILL_H
+#define GOURAUDFILL_H
+
+#include "Affine.h"
+#include "Color.h"
+#include "Raster.h"
+
+
+/*!
+******************************************************************************
+  \struct ColorPlane
+
+  \brief
+    The colors of a shaded triangle as a function of device coordinates:
+    each channel is (mBase + (mDx * x) + (mDy * y)). Since the function is
+    defined over the whole plane of the triangle rather than by its corners,
+    the pieces a triangle is clipped into share the same ColorPlane (and so
+    blend exactly as the whole triangle would).
+*******************************************************************************/
+struct ColorPlane
+{
+    /* The red, green and blue channels at the device origin. */
+  double mBase[3];
+    /* The change in each channel per pixel along the x-/y-axis. */
+  double mDx[3];
+  double mDy[3];
+
+    /*
+     * Fit the plane through the colors [cP], [cQ] and [cR] of the corners
+     * [P], [Q] and [R] of a triangle. Degenerate triangles get the flat color
+     * [cP].
+     */
+  void Init(const Point &P, const Point &Q, const Point &R,
+            const Color &cP, const Color &cQ, const Color &cR);
+};
+
+
+/*############################################################################*/
+/*########################### Function Prototypes ############################*/
+/*############################################################################*/
+
+  /*
+   * Fill the triangle [P][Q][R] (in device coordinates, already clipped to
+   * the screen) to the Raster object's pixel buffer, shading each pixel with
+   * [plane]. The pixels filled are the ones FillTriangle fills (the pixel
+   * centers in [left, right) on the scanlines in [bottom, top)), and the
+   * colors are stepped in fixed point along each span rather than evaluated
+   * for every pixel.
+   */
+void FillShadedTriangle(      Raster     &raster,
+                        const Point      &P,
+                        const Point      &Q,
+                        const Point      &R,
+                        const ColorPlane &plane);
+  /* Tint the color [color] by [tint] (white leaving it unchanged). */
+Color TintColor(const Color &color, const Color &tint);
+
+
+#endif
@@ -0,0 +1,811 @@
+/*!
+*****************************************************************************
+\file   Instancing.cpp
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the implementation of DrawInstances and the two halves
+  it is built from.
+*******************************************************************************/
+#include "Instancing.h"
+#include "ClippedLine.h"
+#include "GouraudFill.h"
+#include "MeshLod.h"
+#include "MsaaFill.h"
+#include "PolygonFill.h"
+#include "RasterUtilities.h"
+#include "ScreenClip.h"
+#include "SmoothLine.h"
+#include "TaskPool.h"
+#include "TextureFill.h"
+#include <algorithm>
+#include <cmath>
+
+
+/*############################################################################*/
+/*############################# Global Constants #############################*/
+/*############################################################################*/
+
+  /* Minimum number of instances transformed by each thread. */
+static const int gMinInstancesPerThread = 256;
+
+
+/*############################################################################*/
+/*############################### Global Data ################################*/
+/*############################################################################*/
+
+  /*
+   * Reusable buffers for the current batch, kept between calls so that
+   * steady-state frames do not allocate.
+   */
+  /* The object-space vertices of the batch's mesh. */
+static std::vector<Point>         sMeshVerts;
+  /* The vertex colors of the batch's mesh (empty when it is flat shaded). */
+static std::vector<Color>         sMeshColors;
+  /* The vertex colors of the instance being drawn, tinted by its face color. */
+static std::vector<Color>         sShadeColors;
+  /* The texture/texture coordinates of the batch's mesh (NULL when untextured). */
+static const Texture             *sMeshTexture = NULL;
+static std::vector<Point>         sMeshUVs;
+  /*
+   * Each level of detail of the batch's mesh (just the mesh itself when it
+   * has none), decoded into flat index lists.
+   */
+struct LevelIndices
+{
+    /* The vertices the level uses. */
+  std::vector<int> mVertices;
+  std::vector<int> mFaces;
+  std::vector<int> mEdges;
+    /* The outline of the level's faces (see MeshOutline()). */
+  std::vector<int> mOutline;
+};
+static std::vector<LevelIndices>  sLevels;
+  /* The level of detail each instance is drawn at (past the last: a box or a pixel). */
+static std::vector<int>           sInstanceLevels;
+  /* The transformed vertices of every instance ([count] x [vertex count]). */
+static std::vector<Point>         sInstanceVerts;
+  /*
+   * The device-space bounding box of each instance, used to skip clipping
+   * for instances lying entirely inside the clip rectangle.
+   */
+static std::vector<float>         sInstanceBoxes;
+  /* Reusable vertex buffer for clipping faces. */
+static std::vector<Point>         sClipVerts;
+
+
+/*############################################################################*/
+/*######################## Local Function Prototypes #########################*/
+/*############################################################################*/
+
+static void DecodeMesh       (MyMesh &mesh, const MeshLod *pLod);
+static void DrawInstanceFaces(Raster &raster, const Point *pVerts, const LevelIndices &level,
+                              const Color &faceColor, bool inside, const DirtyRect &clipRect,
+                              Clip *pRectClip);
+static void DrawInstanceEdges(Raster &raster, const Point *pVerts, const LevelIndices &level,
+                              const Color &edgeColor, bool inside, const DirtyRect &clipRect,
+                              Clip *pRectClip, bool smooth, const StrokeStyle *pStroke);
+static void DrawInstanceBox  (Raster &raster, const float *pBox, bool splat,
+                              const Color &color, const DirtyRect &clipRect);
+
+
+/*############################################################################*/
+/*######################### Function Implementation ##########################*/
+/*############################################################################*/
+
+/*!
+******************************************************************************
+  \fn void DrawInstances(Raster &raster, MyMesh &mesh,
+                         const Affine2x3 *pTransforms,
+                         const Color *pFaceColors, int count,
+                         const Color &edgeColor, TaskPool *pPool)
+
+  \brief
+    Draw [count] instances of a mesh, each with its own transformation and
+    face color, in one batched pass over the mesh's shared topology.
+
+  \param raster
+    The Raster object that the instances will be drawn to.
+
+  \param mesh
+    The mesh shared by every instance.
+
+  \param pTransforms
+    The object-to-device transformation of each instance.
+
+  \param pFaceColors
+    The face color of each instance.
+
+  \param count
+    The number of instances.
+
+  \param edgeColor
+    The color used to draw the edges of every instance.
+
+  \param pPool
+    Optional TaskPool used to transform the instances in parallel.
+*******************************************************************************/
+void DrawInstances(      Raster    &raster,
+                         MyMesh    &mesh,
+                   const Affine2x3 *pTransforms,
+                   const Color     *pFaceColors,
+                         int        count,
+                   const Color     &edgeColor,
+                         TaskPool  *pPool)
+{
+  if (count <= 0)
+    return;
+
+  TransformInstances(mesh, pTransforms, count,
+                     raster.Width(), raster.Height(), NULL, pPool);
+  DrawTransformedInstances(raster, pFaceColors, NULL, count, edgeColor,
+                           DirtyRect(0, 0, raster.Width(), raster.Height()));
+}
+
+/*!
+******************************************************************************
+  \fn void TransformInstances(MyMesh &mesh, const Affine2x3 *pTransforms,
+                              int count, int width, int height,
+                              DirtyRect *pBounds, TaskPool *pPool,
+                              float reach, const MeshLod *pLod,
+                              float lodError)
+
+  \brief
+    Decode a mesh and transform [count] instances of it into the batch
+    buffers, ready to be drawn by DrawTransformedInstances(). With levels of
+    detail, each instance only has the vertices of the level it is drawn at
+    transformed (those of the coarsest level for a box or a pixel).
+
+  \param mesh
+    The mesh shared by every instance.
+
+  \param pTransforms
+    The object-to-device transformation of each instance.
+
+  \param count
+    The number of instances.
+
+  \param width
+    The width of the screen the instances will be drawn to.
+
+  \param height
+    The height of the screen the instances will be drawn to.
+
+  \param pBounds
+    Optional array receiving the pixels each instance may touch.
+
+  \param pPool
+    Optional TaskPool used to transform the instances in parallel.
+
+  \param reach
+    How far (in pixels) the instances' edges reach past their vertices.
+
+  \param pLod
+    Optional levels of detail of [mesh] to draw the instances at.
+
+  \param lodError
+    How far (in pixels) the levels of detail may stray from [mesh].
+*******************************************************************************/
+void TransformInstances(      MyMesh    &mesh,
+                        const Affine2x3 *pTransforms,
+                              int        count,
+                              int        width,
+                              int        height,
+                              DirtyRect *pBounds,
+                              TaskPool  *pPool,
+                              float      reach,
+                        const MeshLod   *pLod,
+                              float      lodError)
+{
+  if (count <= 0)
+    return;
+
+    /* Per-mesh work: decode the topology once for the whole batch. */
+  DecodeMesh(mesh, pLod);
+
+  const int vertCount = static_cast<int>(sMeshVerts.size());
+
+  sInstanceVerts.resize(static_cast<std::size_t>(count) * vertCount);
+  sInstanceBoxes.resize(static_cast<std::size_t>(count) * 4);
+  sInstanceLevels.assign(count, 0);
+
+    /* Transform every instance's vertices into the shared buffer. */
+  auto transformRange = [=] (int begin, int end, int)
+  {
+    for (int i = begin; i < end; ++i)
+    {
+      Point *pVerts = &sInstanceVerts[static_cast<std::size_t>(i) * vertCount];
+      float *pBox   = &sInstanceBoxes[static_cast<std::size_t>(i) * 4];
+
+        /* Pick the level of detail by how many pixels an object space unit spans. */
+      int level = 0;
+      if (pLod)
+      {
+        const Affine2x3 &M = pTransforms[i];
+        level = pLod->Select(std::sqrt(std::max(((M.m00 * M.m00) + (M.m10 * M.m10)),
+                                                ((M.m01 * M.m01) + (M.m11 * M.m11)))),
+                             lodError);
+        sInstanceLevels[i] = level;
+      }
+        /* Boxes and pixels are bounded by the vertices of the coarsest level. */
+      const int               drawn = std::min(level, (static_cast<int>(sLevels.size()) - 1));
+      const std::vector<int> &used  = sLevels[drawn].mVertices;
+      if (used.empty())
+      {
+        pBox[0] = pBox[1] = pBox[2] = pBox[3] = 0.0f;
+        if (pBounds)
+          pBounds[i] = DirtyRect();
+        continue;
+      }
+      if (level == 0)
+        pTransforms[i].Apply(&sMeshVerts[0], pVerts, vertCount);
+      else
+        for (std::size_t u = 0; u < used.size(); ++u)
+          pTransforms[i].Apply(sMeshVerts[used[u]], pVerts[used[u]]);
+
+      pBox[0] = pBox[2] = pVerts[used[0]].x;
+      pBox[1] = pBox[3] = pVerts[used[0]].y;
+      for (std::size_t u = 1; u < used.size(); ++u)
+      {
+        const Point &P = pVerts[used[u]];
+        pBox[0] = std::min(pBox[0], P.x);
+        pBox[1] = std::min(pBox[1], P.y);
+        pBox[2] = std::max(pBox[2], P.x);
+        pBox[3] = std::max(pBox[3], P.y);
+      }
+
+      if (!pBounds)
+        continue;
+        /*
+         * Pad the box by a pixel on each side (plus the edges' reach) so it
+         * covers every pixel the fill and line rules could touch, then keep
+         * it on screen.
+         */
+      DirtyRect &bounds = pBounds[i];
+      bounds.mX0 = std::max(static_cast<int>(std::floor(pBox[0] - reach)) - 1, 0);
+      bounds.mY0 = std::max(static_cast<int>(std::floor(pBox[1] - reach)) - 1, 0);
+      bounds.mX1 = std::min(static_cast<int>(std::ceil(pBox[2]  + reach)) + 2, width);
+      bounds.mY1 = std::min(static_cast<int>(std::ceil(pBox[3]  + reach)) + 2, height);
+      if (bounds.IsEmpty())
+        bounds = DirtyRect();
+    }
+  };
+  if (pPool)
+    pPool->ParallelFor(count, transformRange, gMinInstancesPerThread);
+  else
+    transformRange(0, count, 0);
+}
+
+/*!
+******************************************************************************
+  \fn void DrawTransformedInstances(Raster &raster, const Color *pFaceColors,
+                                    const int *pOrder, int count,
+                                    const Color &edgeColor,
+                                    const DirtyRect &clipRect,
+                                    Clip *pRectClip, bool frontToBack,
+                                    bool smoothEdges,
+                                    const StrokeStyle *pStroke)
+
+  \brief
+    Draw instances transformed by the last call to TransformInstances(), in
+    the given order: each instance's faces, then its edges, at the level of
+    detail picked for it (or as a box or a pixel in [edgeColor], which its
+    edges would mostly cover anyway at that size). Front to back, everything
+    is drawn in the reverse order instead.
+
+  \param raster
+    The Raster object that the instances will be drawn to.
+
+  \param pFaceColors
+    The face color of each instance (indexed by instance).
+
+  \param pOrder
+    The instances to draw, in order (NULL draws instances 0 to [count] - 1).
+
+  \param count
+    The number of instances to draw.
+
+  \param edgeColor
+    The color used to draw the edges of every instance.
+
+  \param clipRect
+    The pixels that may be drawn to.
+
+  \param pRectClip
+    Clip object that clips to [clipRect] (NULL when it is the whole screen).
+
+  \param frontToBack
+    Whether to draw the last instance first (and each instance's edges before
+    its faces), skipping the instances the Raster object's coverage already
+    hides entirely.
+
+  \param smoothEdges
+    Whether to draw the edges anti-aliased (ignored while the Raster object
+    has coverage set).
+
+  \param pStroke
+    The style to draw the edges in when wider than a pixel (NULL draws them
+    a pixel wide).
+*******************************************************************************/
+void DrawTransformedInstances(      Raster      &raster,
+                              const Color       *pFaceColors,
+                              const int         *pOrder,
+                                    int          count,
+                              const Color       &edgeColor,
+                              const DirtyRect   &clipRect,
+                                    Clip        *pRectClip,
+                                    bool         frontToBack,
+                                    bool         smoothEdges,
+                              const StrokeStyle *pStroke)
+{
+  const int   vertCount = static_cast<int>(sMeshVerts.size());
+    /* The pixel centers of the clip rectangle. */
+  const float xMin      = static_cast<float>(clipRect.mX0);
+  const float yMin      = static_cast<float>(clipRect.mY0);
+  const float xMax      = static_cast<float>(clipRect.mX1 - 1);
+  const float yMax      = static_cast<float>(clipRect.mY1 - 1);
+  SpanBuffer *pCoverage = raster.GetCoverage();
+    /* Blended pixels cannot claim coverage. */
+  const bool  smooth    = (smoothEdges && !pCoverage);
+    /* Wide edges reach past the instances' boxes. */
+  const StrokeStyle *pWide    = ((pStroke && (1.0f < pStroke->mWidth)) ? pStroke : NULL);
+  const int          reach    = (pWide ? static_cast<int>(std::ceil(StrokeReach(*pWide))) : 0);
+    /* Instances at this level or past it are drawn as a box or a pixel. */
+  const int          boxLevel = static_cast<int>(sLevels.size());
+
+    /* Draw each instance in order: its faces, then its edges. */
+  for (int n = 0; n < count; ++n)
+  {
+    const int    k      = (frontToBack ? (count - 1 - n) : n);
+    const int    i      = (pOrder ? pOrder[k] : k);
+    const Point *pVerts = &sInstanceVerts[static_cast<std::size_t>(i) * vertCount];
+    const float *pBox   = &sInstanceBoxes[static_cast<std::size_t>(i) * 4];
+      /* Instances entirely inside the clip rectangle can be drawn as is. */
+    const bool   inside = ((xMin <= pBox[0]) && (pBox[2] <= xMax) &&
+                           (yMin <= pBox[1]) && (pBox[3] <= yMax));
+
+      /* Skip instances hidden behind what was drawn in front of them. */
+    if (frontToBack && pCoverage &&
+        pCoverage->Covers((static_cast<int>(std::floor(pBox[0])) - 1 - reach),
+                          (static_cast<int>(std::floor(pBox[1])) - 1 - reach),
+                          (static_cast<int>(std::ceil(pBox[2]))  + 2 + reach),
+                          (static_cast<int>(std::ceil(pBox[3]))  + 2 + reach)))
+      continue;
+
+    const int level = sInstanceLevels[i];
+    if (boxLevel <= level)
+    {
+      DrawInstanceBox(raster, pBox, (boxLevel < level), edgeColor, clipRect);
+      continue;
+    }
+    if (frontToBack)
+      DrawInstanceEdges(raster, pVerts, sLevels[level], edgeColor, inside, clipRect,
+                        pRectClip, smooth, pWide);
+    DrawInstanceFaces(raster, pVerts, sLevels[level], pFaceColors[i], inside, clipRect,
+                      pRectClip);
+    if (!frontToBack)
+      DrawInstanceEdges(raster, pVerts, sLevels[level], edgeColor, inside, clipRect,
+                        pRectClip, smooth, pWide);
+  }
+}
+
+/*!
+******************************************************************************
+  \fn int CountInstanceLevels(std::vector<int> &counts)
+
+  \brief
+    Count the instances transformed by the last call to TransformInstances()
+    at each level of detail.
+
+  \param counts
+    The number of instances at each level, followed by the number drawn as
+    boxes and as pixels.
+
+  \return
+    The number of faces and edges the instances are drawn with (each box or
+    pixel counting as one).
+*******************************************************************************/
+int CountInstanceLevels(std::vector<int> &counts)
+{
+  const int boxLevel = static_cast<int>(sLevels.size());
+  counts.assign(boxLevel + 2, 0);
+  int primitives = 0;
+  for (std::size_t i = 0; i < sInstanceLevels.size(); ++i)
+  {
+    const int level = sInstanceLevels[i];
+    ++counts[level];
+    primitives += ((level < boxLevel)
+                   ? static_cast<int>((sLevels[level].mFaces.size() / 3) +
+                                      (sLevels[level].mEdges.size() / 2))
+                   : 1);
+  }
+  return primitives;
+}
+
+/*!
+******************************************************************************
+  \fn void DrawInstanceFaces(Raster &raster, const Point *pVerts,
+                             const LevelIndices &level,
+                             const Color &faceColor, bool inside,
+                             const DirtyRect &clipRect, Clip *pRectClip)
+
+  \brief
+    Fill the faces of one transformed instance, clipping them to the screen
+    and to [clipRect] unless they lie inside it.
+
+  \param raster
+    The Raster object that the faces will be drawn to.
+
+  \param pVerts
+    The instance's transformed vertices.
+
+  \param level
+    The level of detail the instance is drawn at.
+
+  \param faceColor
+    The instance's face color (tinting the mesh's texture or vertex colors,
+    if any).
+
+  \param inside
+    Whether the whole instance lies inside [clipRect].
+
+  \param clipRect
+    The pixels that may be drawn to.
+
+  \param pRectClip
+    Clip object that clips to [clipRect] (NULL when it is the whole screen).
+*******************************************************************************/
+void DrawInstanceFaces(      Raster       &raster,
+                       const Point        *pVerts,
+                       const LevelIndices &level,
+                       const Color        &faceColor,
+                             bool          inside,
+                       const DirtyRect    &clipRect,
+                             Clip         *pRectClip)
+{
+  Clip &screenClip = ScreenClip(raster.Width(), raster.Height());
+
+  const int   faceCount = static_cast<int>(level.mFaces.size() / 3);
+  const bool  textured  = (sMeshTexture != NULL);
+  const bool  shaded    = (!textured && !sMeshColors.empty());
+    /* Flat faces get anti-aliased edges while multisampling. */
+  const bool  sampled   = (!textured && !shaded && raster.GetSamples());
+  const int  *pFace     = (faceCount ? &level.mFaces[0] : NULL);
+    /* The pixel centers of the screen and of the clip rectangle. */
+  const float wMax      = static_cast<float>(raster.Width()  - 1);
+  const float hMax      = static_cast<float>(raster.Height() - 1);
+  const float xMin      = static_cast<float>(clipRect.mX0);
+  const float yMin      = static_cast<float>(clipRect.mY0);
+  const float xMax      = static_cast<float>(clipRect.mX1 - 1);
+  const float yMax      = static_cast<float>(clipRect.mY1 - 1);
+
+  SpanBuffer *pCoverage = raster.GetCoverage();
+
+  raster.SetColor(faceColor.red, faceColor.grn, faceColor.blu);
+    /*
+     * Flat faces are filled all at once, through the mesh's outline, a span
+     * per scanline (clipped as they are filled).
+     */
+  if (!textured && !shaded && !sampled && !level.mOutline.empty())
+  {
+    FillPolygonEdges(raster, pVerts, &level.mOutline[0],
+                     static_cast<int>(level.mOutline.size() / 2), eNonZero, clipRect);
+    return;
+  }
+  if (shaded)
+  {
+    sShadeColors.resize(sMeshColors.size());
+    for (unsigned int v = 0; v < sMeshColors.size(); ++v)
+      sShadeColors[v] = TintColor(faceColor, sMeshColors[v]);
+  }
+  for (int f = 0; f < faceCount; ++f, pFace += 3)
+  {
+    const Point &P = pVerts[pFace[0]];
+    const Point &Q = pVerts[pFace[1]];
+    const Point &R = pVerts[pFace[2]];
+      /* Skip faces hidden behind what was drawn in front of them. */
+    if (pCoverage &&
+        pCoverage->Covers((static_cast<int>(std::floor(std::min(std::min(P.x, Q.x), R.x))) - 1),
+                          (static_cast<int>(std::floor(std::min(std::min(P.y, Q.y), R.y))) - 1),
+                          (static_cast<int>(std::ceil (std::max(std::max(P.x, Q.x), R.x))) + 2),
+                          (static_cast<int>(std::ceil (std::max(std::max(P.y, Q.y), R.y))) + 2)))
+      continue;
+      /*
+       * Shaded/textured faces are fit with their colors/texture coordinates
+       * before being clipped, so that the pieces they are cut into are filled
+       * as the whole face would be.
+       */
+    ColorPlane plane;
+    UVPlane    uvPlane;
+    if (shaded)
+      plane.Init(P, Q, R, sShadeColors[pFace[0]],
+                          sShadeColors[pFace[1]],
+                          sShadeColors[pFace[2]]);
+    if (textured)
+      uvPlane.Init(P, Q, R, sMeshUVs[pFace[0]],
+                            sMeshUVs[pFace[1]],
+                            sMeshUVs[pFace[2]]);
+      /* As can faces of the rest that lie inside it. */
+    if (inside ||
+        (InRect(P, xMin, yMin, xMax, yMax) &&
+         InRect(Q, xMin, yMin, xMax, yMax) &&
+         InRect(R, xMin, yMin, xMax, yMax)))
+    {
+      if (textured)
+        FillTexturedTriangle(raster, P, Q, R, uvPlane, *sMeshTexture, faceColor);
+      else if (shaded)
+        FillShadedTriangle(raster, P, Q, R, plane);
+      else if (sampled)
+        FillMultisampledTriangle(raster, P, Q, R, faceColor);
+      else
+        FillTriangle(raster, P, Q, R);
+      continue;
+    }
+    sClipVerts.clear();
+    sClipVerts.push_back(P);
+    sClipVerts.push_back(Q);
+    sClipVerts.push_back(R);
+      /* Faces reaching past the screen are cut to it exactly as usual... */
+    if (!(InRect(P, 0.0f, 0.0f, wMax, hMax) &&
+          InRect(Q, 0.0f, 0.0f, wMax, hMax) &&
+          InRect(R, 0.0f, 0.0f, wMax, hMax)) &&
+        !screenClip(sClipVerts))
+      continue;
+      /* ...before being cut to the rectangle. */
+    if (pRectClip && !(*pRectClip)(sClipVerts))
+      continue;
+    for (unsigned int j = 1; j < sClipVerts.size() - 1; ++j)
+      if (textured)
+        FillTexturedTriangle(raster, sClipVerts[0], sClipVerts[j], sClipVerts[j + 1],
+                             uvPlane, *sMeshTexture, faceColor);
+      else if (shaded)
+        FillShadedTriangle(raster, sClipVerts[0], sClipVerts[j], sClipVerts[j + 1], plane);
+      else if (sampled)
+        FillMultisampledTriangle(raster, sClipVerts[0], sClipVerts[j], sClipVerts[j + 1],
+                                 faceColor);
+      else
+        FillTriangle(raster, sClipVerts[0], sClipVerts[j], sClipVerts[j + 1]);
+  }
+}
+
+/*!
+******************************************************************************
+  \fn void DrawInstanceEdges(Raster &raster, const Point *pVerts,
+                             const LevelIndices &level,
+                             const Color &edgeColor, bool inside,
+                             const DirtyRect &clipRect, Clip *pRectClip,
+                             bool smooth, const StrokeStyle *pStroke)
+
+  \brief
+    Draw the edges of one transformed instance, clipping them to the screen
+    and to [clipRect] unless they lie inside it.
+
+  \param raster
+    The Raster object that the edges will be drawn to.
+
+  \param pVerts
+    The instance's transformed vertices.
+
+  \param level
+    The level of detail the instance is drawn at.
+
+  \param edgeColor
+    The color used to draw the edges.
+
+  \param inside
+    Whether the whole instance lies inside [clipRect].
+
+  \param clipRect
+    The pixels that may be drawn to.
+
+  \param pRectClip
+    Clip object that clips to [clipRect] (NULL when it is the whole screen).
+
+  \param smooth
+    Whether to draw the edges anti-aliased.
+
+  \param pStroke
+    The style to draw the edges in (NULL draws them a pixel wide).
+*******************************************************************************/
+void DrawInstanceEdges(      Raster       &raster,
+                       const Point        *pVerts,
+                       const LevelIndices &level,
+                       const Color        &edgeColor,
+                             bool          inside,
+                       const DirtyRect    &clipRect,
+                             Clip         *pRectClip,
+                             bool          smooth,
+                       const StrokeStyle  *pStroke)
+{
+  Clip &screenClip = ScreenClip(raster.Width(), raster.Height());
+
+  const int   edgeCount = static_cast<int>(level.mEdges.size() / 2);
+  const int  *pEdge     = (edgeCount ? &level.mEdges[0] : NULL);
+
+    /* Wide edges are clipped to the rectangle pixel by pixel as they are filled. */
+  if (pStroke)
+  {
+    raster.SetColor(edgeColor.red, edgeColor.grn, edgeColor.blu);
+    DrawEdgeStrokes(raster, pVerts, pEdge, edgeCount, *pStroke, clipRect);
+    return;
+  }
+
+    /* The pixel centers of the screen and of the clip rectangle. */
+  const float wMax      = static_cast<float>(raster.Width()  - 1);
+  const float hMax      = static_cast<float>(raster.Height() - 1);
+  const float xMin      = static_cast<float>(clipRect.mX0);
+  const float yMin      = static_cast<float>(clipRect.mY0);
+  const float xMax      = static_cast<float>(clipRect.mX1 - 1);
+  const float yMax      = static_cast<float>(clipRect.mY1 - 1);
+
+  raster.SetColor(edgeColor.red, edgeColor.grn, edgeColor.blu);
+  for (int e = 0; e < edgeCount; ++e, pEdge += 2)
+  {
+    Point P = pVerts[pEdge[0]];
+    Point Q = pVerts[pEdge[1]];
+    bool cut = false;
+    if (!inside &&
+        !(InRect(P, xMin, yMin, xMax, yMax) &&
+          InRect(Q, xMin, yMin, xMax, yMax)))
+    {
+      if (!(InRect(P, 0.0f, 0.0f, wMax, hMax) &&
+            InRect(Q, 0.0f, 0.0f, wMax, hMax)) &&
+          !screenClip(P, Q))
+        continue;
+        /*
+         * Aliased lines are stepped from where the screen cuts them and cut
+         * to the rectangle pixel by pixel, so that they plot the same pixels
+         * there as when drawn whole (cutting their ends would restart their
+         * steps at the rectangle's border).
+         */
+      if (pRectClip && smooth && !(*pRectClip)(P, Q))
+        continue;
+      cut = (pRectClip && !smooth);
+    }
+    if (smooth)
+      DrawSmoothLine(raster, P, Q);
+    else if (cut)
+      DrawClippedLine(raster, P, Q, clipRect.mX0, clipRect.mY0, clipRect.mX1, clipRect.mY1);
+    else
+      DrawLine(raster, P, Q);
+  }
+}
+
+/*!
+******************************************************************************
+  \fn void DrawInstanceBox(Raster &raster, const float *pBox, bool splat,
+                           const Color &color, const DirtyRect &clipRect)
+
+  \brief
+    Draw an instance too small for its mesh: fill the pixels whose centers
+    lie in its box (as FillTriangle would), or just the pixel nearest its
+    center (also used across boxes too thin to hold a pixel center).
+
+  \param raster
+    The Raster object that the instance will be drawn to.
+
+  \param pBox
+    The instance's device-space bounding box.
+
+  \param splat
+    Whether to draw only the pixel at the center of the box.
+
+  \param color
+    The color to draw the instance in.
+
+  \param clipRect
+    The pixels that may be drawn to.
+*******************************************************************************/
+void DrawInstanceBox(      Raster    &raster,
+                     const float     *pBox,
+                           bool       splat,
+                     const Color     &color,
+                     const DirtyRect &clipRect)
+{
+    /* Clamped before converting, so that far off boxes cannot overflow. */
+  double       x0 = std::ceil(static_cast<double>(pBox[0]));
+  double       y0 = std::ceil(static_cast<double>(pBox[1]));
+  double       x1 = std::ceil(static_cast<double>(pBox[2]));
+  double       y1 = std::ceil(static_cast<double>(pBox[3]));
+    /* The pixel nearest the center, for boxes too thin to hold a pixel center. */
+  const double cx = std::floor(0.5 * ((static_cast<double>(pBox[0]) + pBox[2]) + 1.0));
+  const double cy = std::floor(0.5 * ((static_cast<double>(pBox[1]) + pBox[3]) + 1.0));
+  if (splat || !(x0 < x1))
+  {
+    x0 = cx;
+    x1 = (cx + 1.0);
+  }
+  if (splat || !(y0 < y1))
+  {
+    y0 = cy;
+    y1 = (cy + 1.0);
+  }
+  x0 = std::max(x0, static_cast<double>(clipRect.mX0));
+  y0 = std::max(y0, static_cast<double>(clipRect.mY0));
+  x1 = std::min(x1, static_cast<double>(clipRect.mX1));
+  y1 = std::min(y1, static_cast<double>(clipRect.mY1));
+  if (!((x0 < x1) && (y0 < y1)))
+    return;
+
+  raster.SetColor(color.red, color.grn, color.blu);
+  for (int y = static_cast<int>(y0); y < static_cast<int>(y1); ++y)
+  {
+    raster.GotoPoint(static_cast<int>(x0), y);
+    raster.WriteSpan(static_cast<int>(x1) - static_cast<int>(x0));
+  }
+}
+
+/*!
+******************************************************************************
+  \fn void DecodeMesh(MyMesh &mesh, const MeshLod *pLod)
+
+  \brief
+    Copy the vertices (and vertex colors/texture coordinates) of [mesh] and
+    decode its faces and edges (and those of each of its levels of detail)
+    into the flat index lists used while drawing the batch.
+
+  \param mesh
+    The mesh to decode.
+
+  \param pLod
+    Optional levels of detail of the mesh (the first being the mesh itself).
+*******************************************************************************/
+void DecodeMesh(MyMesh &mesh, const MeshLod *pLod)
+{
+  sMeshVerts.clear();
+  sMeshColors.assign(mesh.mVertColors.begin(), mesh.mVertColors.end());
+  sMeshUVs.assign(mesh.mVertUVs.begin(), mesh.mVertUVs.end());
+  sMeshTexture = (mesh.mVertUVs.empty() ? NULL : mesh.mpTexture);
+  sLevels.resize((pLod && !pLod->mLevels.empty()) ? pLod->mLevels.size() : 1);
+
+    /* Level 0 is the mesh itself, using every vertex. */
+  LevelIndices &full = sLevels[0];
+  full.mVertices.clear();
+  full.mFaces.clear();
+  full.mEdges.clear();
+  full.mOutline.assign(mesh.Outline().begin(), mesh.Outline().end());
+  for (int i = 0; i < mesh.VertexCount(); ++i)
+  {
+    sMeshVerts.push_back(mesh.GetVertex(i));
+    full.mVertices.push_back(i);
+  }
+  for (int i = 0; i < mesh.FaceCount(); ++i)
+  {
+    const Mesh::Face f = mesh.GetFace(i);
+    full.mFaces.push_back(f.index1);
+    full.mFaces.push_back(f.index2);
+    full.mFaces.push_back(f.index3);
+  }
+  for (int i = 0; i < mesh.EdgeCount(); ++i)
+  {
+    const Mesh::Edge e = mesh.GetEdge(i);
+    full.mEdges.push_back(e.index1);
+    full.mEdges.push_back(e.index2);
+  }
+
+  for (std::size_t l = 1; l < sLevels.size(); ++l)
+  {
+    const MeshLodLevel &source = pLod->mLevels[l];
+    LevelIndices       &level  = sLevels[l];
+    level.mVertices.assign(source.mVertices.begin(), source.mVertices.end());
+    level.mOutline.assign(source.mOutline.begin(), source.mOutline.end());
+    level.mFaces.clear();
+    level.mEdges.clear();
+    for (std::size_t f = 0; f < source.mFaces.size(); ++f)
+    {
+      level.mFaces.push_back(source.mFaces[f].index1);
+      level.mFaces.push_back(source.mFaces[f].index2);
+      level.mFaces.push_back(source.mFaces[f].index3);
+    }
+    for (std::size_t e = 0; e < source.mEdges.size(); ++e)
+    {
+      level.mEdges.push_back(source.mEdges[e].index1);
+      level.mEdges.push_back(source.mEdges[e].index2);
+    }
+  }
+}
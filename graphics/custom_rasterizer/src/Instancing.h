@@ -0,0 +1,103 @@
+/*!
+*****************************************************************************
+\file   Instancing.h
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the prototypes of DrawInstances, which draws many copies
+  (instances) of one mesh in a single batched pass, along with the two halves
+  it is built from so a batch can be transformed once and drawn piecewise.
+  Each instance can be drawn at a level of detail of the mesh picked by its
+  size on screen (see MeshLod).
+*******************************************************************************/
+#ifndef INSTANCING_H
+#define INSTANCING_H
+
+#include "Affine2x3.h"
+#include "Clip.h"
+#include "Color.h"
+#include "DamageTracker.h"
+#include "MyMesh.h"
+#include "Raster.h"
+#include "Stroke.h"
+
+class TaskPool;
+struct MeshLod;
+
+
+/*############################################################################*/
+/*########################### Function Prototypes ############################*/
+/*############################################################################*/
+
+  /*
+   * Draw [count] instances of [mesh] to the Raster object's pixel buffer. The
+   * i_th instance is transformed by [pTransforms][i] (object-to-device) and
+   * its faces are filled with [pFaceColors][i] (or with the mesh's texture or
+   * vertex colors, tinted by it), then its edges are drawn in [edgeColor]. The mesh's topology is decoded once for the whole batch, and
+   * the vertices of every instance are transformed up front (in parallel
+   * when [pPool] is given) before anything is drawn. Instances are drawn in
+   * order, faces then edges, exactly as Rasterize() would draw them.
+   */
+void DrawInstances(      Raster    &raster,
+                         MyMesh    &mesh,
+                   const Affine2x3 *pTransforms,
+                   const Color     *pFaceColors,
+                         int        count,
+                   const Color     &edgeColor = Color(),
+                         TaskPool  *pPool     = NULL);
+  /*
+   * Decode [mesh] and transform [count] instances of it by [pTransforms] into
+   * the batch buffers (in parallel when [pPool] is given). When [pBounds] is
+   * given, it receives the pixels of a [width] x [height] screen that each
+   * instance may touch (empty for instances entirely off screen), padded by
+   * [reach] pixels for edges drawn wide (see StrokeReach()). When [pLod]
+   * (the levels of detail of [mesh]) is given, each instance is drawn at the
+   * level MeshLod::Select() picks for it, straying up to [lodError] pixels.
+   */
+void TransformInstances(      MyMesh    &mesh,
+                        const Affine2x3 *pTransforms,
+                              int        count,
+                              int        width,
+                              int        height,
+                              DirtyRect *pBounds  = NULL,
+                              TaskPool  *pPool    = NULL,
+                              float      reach    = 0.0f,
+                        const MeshLod   *pLod     = NULL,
+                              float      lodError = 0.0f);
+  /*
+   * Draw [count] of the instances transformed by the last call to
+   * TransformInstances(), the i_th being instance [pOrder][i] (or just i when
+   * [pOrder] is NULL), restricted to the pixels in [clipRect]. Geometry is
+   * clipped to the screen as usual, then by [pRectClip] (built by RectClip()
+   * for [clipRect]) when the rectangle is smaller than the screen. With
+   * [frontToBack], everything is drawn in the reverse order (for a Raster
+   * object with coverage set, see Raster::SetCoverage()), and instances it
+   * already covers entirely are skipped. With [smoothEdges], the edges are
+   * drawn with DrawSmoothLine() (unless the Raster object has coverage set).
+   * With [pStroke] wider than a pixel, the edges are drawn with
+   * DrawEdgeStrokes() in its style instead.
+   */
+void DrawTransformedInstances(      Raster      &raster,
+                              const Color       *pFaceColors,
+                              const int         *pOrder,
+                                    int          count,
+                              const Color       &edgeColor,
+                              const DirtyRect   &clipRect,
+                                    Clip        *pRectClip   = NULL,
+                                    bool         frontToBack = false,
+                                    bool         smoothEdges = false,
+                              const StrokeStyle *pStroke     = NULL);
+  /*
+   * Count the instances transformed by the last call to TransformInstances()
+   * at each level of detail into [counts] (the last two being those drawn as
+   * boxes and as pixels), returning the faces and edges they are drawn with.
+   */
+int CountInstanceLevels(std::vector<int> &counts);
+
+#endif
+
@@ -0,0 +1,143 @@
+/*!
+*****************************************************************************
+\file   LayerCache.cpp
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the implementation of the LayerCache class' methods.
+*******************************************************************************/
+#include "LayerCache.h"
+#include <algorithm>
+#include <cstring>
+
+
+/*############################################################################*/
+/*############################## Public Methods ##############################*/
+/*############################################################################*/
+
+  /* Default Constructor. */
+LayerCache::LayerCache(void)
+  : mPixels(),
+    mWidth(0),
+    mHeight(0),
+    mStride(0),
+    mWorldToDev(),
+    mVersion(0),
+    mValid(false),
+    mOfferedWorldToDev(),
+    mOfferedVersion(0),
+    mOffered(false) { ; }
+
+  /* Whether the cached layer is valid for the given frame buffer/view/content. */
+bool LayerCache::IsValid(const Raster &raster, const Affine &worldToDev, unsigned version) const
+{
+  return (mValid                           &&
+          (mWidth   == raster.Width())     &&
+          (mHeight  == raster.Height())    &&
+          (mStride  == raster.Stride())    &&
+          (mVersion == version)            &&
+          SameView(mWorldToDev, worldToDev));
+}
+
+  /* Get the cached pixels. */
+const Raster::byte *LayerCache::Pixels(void) const
+{ return (mPixels.empty() ? NULL : &mPixels[0]); }
+
+  /* Copy the cached layer over the frame buffer if it is valid for it. */
+bool LayerCache::Restore(Raster &raster, const Affine &worldToDev, unsigned version) const
+{
+  if (!IsValid(raster, worldToDev, version))
+    return false;
+
+    /* The copy is laid out exactly like the frame buffer: one memcpy. */
+  std::memcpy(raster.Buffer(), &mPixels[0], mPixels.size());
+  return true;
+}
+
+  /* Copy a rectangle of the cached layer over the frame buffer. */
+void LayerCache::RestoreRect(Raster &raster, int x0, int y0, int x1, int y1) const
+{
+  x0 = std::max(x0, 0);
+  y0 = std::max(y0, 0);
+  x1 = std::min(x1, mWidth);
+  y1 = std::min(y1, mHeight);
+  if ((x1 <= x0) || (y1 <= y0))
+    return;
+
+  const std::size_t rowBytes = (3 * static_cast<std::size_t>(x1 - x0));
+  for (int y = y0; y < y1; ++y)
+  {
+    const std::size_t offset = ((static_cast<std::size_t>(y) * mStride) + (3 * x0));
+    std::memcpy((raster.Buffer() + offset), (&mPixels[0] + offset), rowBytes);
+  }
+}
+
+  /* Offer the content just drawn for caching. */
+void LayerCache::Offer(const Raster &raster, const Affine &worldToDev, unsigned version)
+{
+    /* Only take a copy once the view has held still for a frame. */
+  if (mOffered                      &&
+      (mOfferedVersion == version)  &&
+      SameView(mOfferedWorldToDev, worldToDev))
+    Store(raster, worldToDev, version);
+
+  mOfferedWorldToDev = worldToDev;
+  mOfferedVersion    = version;
+  mOffered           = true;
+}
+
+  /* Unconditionally copy the content just drawn. */
+void LayerCache::Store(const Raster &raster, const Affine &worldToDev, unsigned version)
+{
+  mWidth      = raster.Width();
+  mHeight     = raster.Height();
+  mStride     = raster.Stride();
+  mWorldToDev = worldToDev;
+  mVersion    = version;
+  mPixels.assign(raster.Buffer(),
+                 (raster.Buffer() + (static_cast<std::size_t>(mHeight) * mStride)));
+  mValid      = true;
+}
+
+  /* Drop the cached layer. */
+void LayerCache::Invalidate(void)
+{
+  mValid   = false;
+  mOffered = false;
+}
+
+
+/*############################################################################*/
+/*####################### Non-member Helper Functions ########################*/
+/*############################################################################*/
+
+/*!
+******************************************************************************
+  \fn bool SameView(const Affine &A, const Affine &B)
+
+  \brief
+    Check whether two views are exactly the same.
+
+  \param A
+    The first world-to-device transformation.
+
+  \param B
+    The second world-to-device transformation.
+
+  \return
+    Whether every entry of the two transformations is equal.
+*******************************************************************************/
+bool SameView(const Affine &A, const Affine &B)
+{
+  for (int i = 0; i < 2; ++i)
+    for (int j = 0; j < 3; ++j)
+      if (A[i][j] != B[i][j])
+        return false;
+
+  return true;
+}
@@ -0,0 +1,113 @@
+/*!
+*****************************************************************************
+\file   LayerCache.h
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the definition of the LayerCache class, which keeps a
+  copy of the static layer of the frame (i.e. the background) so it does not
+  need to be redrawn while the camera holds still.
+*******************************************************************************/
+#ifndef LAYERCACHE_H
+#define LAYERCACHE_H
+
+#include "Affine.h"
+#include "Raster.h"
+#include <vector>
+
+
+/*!
+******************************************************************************
+  \class LayerCache
+
+  \brief
+    Stores a copy of the frame buffer right after the static content was
+    drawn, along with what that content depended on: the frame buffer's
+    layout, the world-to-device transformation it was drawn through and a
+    version number for the content itself. While all three match, the copy can
+    be restored with a single memcpy instead of drawing the content again.
+
+    Copying the frame buffer only pays off when the view holds still, so a new
+    copy is only taken once the same view has been offered twice in a row.
+*******************************************************************************/
+class LayerCache
+{
+/*############################################################################*/
+/*############################## Public Methods ##############################*/
+/*############################################################################*/
+public:
+
+  /******************************* Constructors *******************************/
+    /* Default Constructor. */
+  LayerCache(void);
+
+  /********************************* Getters **********************************/
+    /*
+     * Whether the cached layer was drawn into a frame buffer laid out like
+     * [raster], through [worldToDev], from content version [version].
+     */
+  bool IsValid(const Raster &raster, const Affine &worldToDev, unsigned version) const;
+    /* Get the cached pixels (laid out exactly like the frame buffer). */
+  const Raster::byte *Pixels(void) const;
+
+  /********************************* Mutators *********************************/
+    /*
+     * Copy the cached layer over [raster]'s frame buffer if it is valid for
+     * it. Returns whether the layer was restored.
+     */
+  bool Restore(Raster &raster, const Affine &worldToDev, unsigned version) const;
+    /*
+     * Copy the rectangle [x0, x1) x [y0, y1) of the cached layer over the same
+     * rectangle of [raster]'s frame buffer (the layer must be valid).
+     */
+  void RestoreRect(Raster &raster, int x0, int y0, int x1, int y1) const;
+    /*
+     * Offer the content just drawn to [raster] through [worldToDev] for
+     * caching. It is copied if the same view was offered last time.
+     */
+  void Offer(const Raster &raster, const Affine &worldToDev, unsigned version);
+    /* Unconditionally copy the content just drawn to [raster]. */
+  void Store(const Raster &raster, const Affine &worldToDev, unsigned version);
+    /* Drop the cached layer. */
+  void Invalidate(void);
+
+
+/*############################################################################*/
+/*############################# Private Members ##############################*/
+/*############################################################################*/
+private:
+    /* The cached pixels. */
+  std::vector<Raster::byte> mPixels;
+    /* The layout of the frame buffer the pixels were copied from. */
+  int                       mWidth;
+  int                       mHeight;
+  int                       mStride;
+    /* The view and content version the pixels were drawn with. */
+  Affine                    mWorldToDev;
+  unsigned                  mVersion;
+  bool                      mValid;
+    /* The view and content version offered last time. */
+  Affine                    mOfferedWorldToDev;
+  unsigned                  mOfferedVersion;
+  bool                      mOffered;
+};
+
+
+/*############################################################################*/
+/*########################### Function Prototypes ############################*/
+/*############################################################################*/
+
+  /*
+   * Whether two views (world-to-device transformations) are exactly the
+   * same, so that what was drawn through one can be reused for the other.
+   */
+bool SameView(const Affine &A, const Affine &B);
+
+
+#endif
+
@@ -0,0 +1,732 @@
+/*!
+*****************************************************************************
+\file   MeshBuilder.cpp
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the implementation of BuildMeshLayout,
+  BuildMeshLayouts, CopyMeshLayout, OptimizeMeshLayout and PackMeshLayout.
+
+  Polygons are triangulated by ear clipping. The boundary is walked
+  counterclockwise and each hole clockwise; holes are first joined to the
+  boundary (rightmost hole first) by a pair of coincident edges running from
+  the hole's rightmost vertex to a vertex of the boundary it can see, found
+  by casting a ray towards +x. The joined ring is then clipped one ear at a
+  time: a convex corner whose triangle holds no other vertex of the ring is
+  cut off as a face. Corners with no area add nothing, and are dropped
+  without a face. The faces are all wound counterclockwise, so the sides of
+  the contours (the boundary counterclockwise, the holes clockwise) are the
+  outline of the faces MeshOutline() would find.
+
+  Repeated faces and edges are found by sorting keys made of their sorted
+  vertex indices, so that repeats end up next to each other; the faces
+  sharing a side are found the same way, from keys made of each face's
+  sides. The faces are then reordered breadth first across those shared
+  sides, starting again from the first face not yet reached whenever a
+  piece of the mesh runs out.
+*******************************************************************************/
+#include "MeshBuilder.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+
+/*############################################################################*/
+/*############################# Global Constants #############################*/
+/*############################################################################*/
+
+  /* The fewest polygons worth handing each thread when building them at once. */
+static const int gMinPolygonsPerThread = 16;
+  /* The most vertices a layout may have to be packed with 16 bit indices. */
+static const int gShortIndexLimit = 65536;
+
+
+/*############################################################################*/
+/*########################## Local Helper Functions ##########################*/
+/*############################################################################*/
+
+  /* A hole of a polygon, and its vertex furthest right. */
+struct HoleInfo
+{
+  float mX;
+  int   mContour;
+  int   mRightmost;
+};
+
+  /*
+   * Buffers reused while triangulating polygons (one set per thread when
+   * building them at once).
+   */
+struct EarScratch
+{
+    /* The vertices of the boundary, with the holes joined in, in order. */
+  std::vector<int> mRing;
+    /* The corners of the ring still to be clipped, as a linked list. */
+  std::vector<int> mPrev;
+  std::vector<int> mNext;
+    /* The holes, to be sorted rightmost first. */
+  std::vector<HoleInfo> mHoles;
+};
+
+  /*
+   * The sorted vertex indices of a face or edge (the last being -1 for an
+   * edge) or of a face's side, and the primitive it came from.
+   */
+struct IndexKey
+{
+  int mIndices[3];
+  int mPrimitive;
+
+    /* Whether the indices of [this] and [rhs] are the same. */
+  bool SameIndices(const IndexKey &rhs) const
+  {
+    return ((mIndices[0] == rhs.mIndices[0]) && (mIndices[1] == rhs.mIndices[1]) &&
+            (mIndices[2] == rhs.mIndices[2]));
+  }
+    /* Order keys by their indices, then by primitive. */
+  bool operator<(const IndexKey &rhs) const
+  {
+    for (int i = 0; i < 3; ++i)
+      if (mIndices[i] != rhs.mIndices[i])
+        return (mIndices[i] < rhs.mIndices[i]);
+    return (mPrimitive < rhs.mPrimitive);
+  }
+};
+
+  /* Make the key of the primitive [primitive] with the indices [i], [j] and [k]. */
+static IndexKey MakeKey(int i, int j, int k, int primitive)
+{
+  IndexKey key = { { i, j, k }, primitive };
+  if (key.mIndices[1] < key.mIndices[0])
+    std::swap(key.mIndices[0], key.mIndices[1]);
+  if ((0 <= k) && (key.mIndices[2] < key.mIndices[1]))
+  {
+    std::swap(key.mIndices[1], key.mIndices[2]);
+    if (key.mIndices[1] < key.mIndices[0])
+      std::swap(key.mIndices[0], key.mIndices[1]);
+  }
+  return key;
+}
+
+  /* Mark in [repeated] every primitive whose key repeats an earlier one's in [keys]. */
+static void MarkRepeats(std::vector<IndexKey> &keys, std::vector<bool> &repeated)
+{
+  std::sort(keys.begin(), keys.end());
+  for (std::size_t k = 1; k < keys.size(); ++k)
+    if (keys[k].SameIndices(keys[k - 1]))
+      repeated[keys[k].mPrimitive] = true;
+}
+
+  /* The bytes the data of [layout] takes once packed by PackMeshLayout(). */
+static std::size_t PackedBytes(const MeshLayout &layout)
+{
+  const std::size_t indexCount = ((2 * layout.mEdges.size()) + (3 * layout.mFaces.size()));
+  const std::size_t indexSize  = ((static_cast<int>(layout.mVertices.size()) <= gShortIndexLimit) ?
+                                  sizeof(unsigned short) : sizeof(int));
+  return ((layout.mVertices.size() * sizeof(Point)) + (indexCount * indexSize) +
+          (layout.mOutline.size() * sizeof(int)));
+}
+
+  /* Twice the signed area of the triangle [A][B][C] (positive when counterclockwise). */
+static double Cross(const Point &A, const Point &B, const Point &C)
+{
+  return (((static_cast<double>(B.x) - A.x) * (static_cast<double>(C.y) - A.y)) -
+          ((static_cast<double>(B.y) - A.y) * (static_cast<double>(C.x) - A.x)));
+}
+
+  /* Whether [P] and [Q] are the same point. */
+static bool SamePoint(const Point &P, const Point &Q)
+{ return ((P.x == Q.x) && (P.y == Q.y)); }
+
+  /* Whether [P] lies inside (or on) the counterclockwise triangle [A][B][C]. */
+static bool InTriangle(const Point &P, const Point &A, const Point &B, const Point &C)
+{ return ((0.0 <= Cross(A, B, P)) && (0.0 <= Cross(B, C, P)) && (0.0 <= Cross(C, A, P))); }
+
+  /* Twice the signed area of the contour made of the points [first, end) of [verts]. */
+static double ContourArea(const std::vector<Point> &verts, int first, int end)
+{
+  double area = 0.0;
+  for (int i = first; i < end; ++i)
+  {
+    const Point &P = verts[i];
+    const Point &Q = verts[((i + 1) < end) ? (i + 1) : first];
+    area += ((static_cast<double>(P.x) * Q.y) - (static_cast<double>(Q.x) * P.y));
+  }
+  return area;
+}
+
+  /*
+   * Join the hole made of the points [first, end) of [verts] (walked
+   * clockwise, backwards when [reversed]) to [ring], starting from its
+   * vertex [m] (the one furthest right). Returns false when no vertex of the
+   * ring can be seen from it.
+   */
+static bool JoinHole(const std::vector<Point> &verts,
+                           int                 first,
+                           int                 end,
+                           bool                reversed,
+                           int                 m,
+                           std::vector<int>   &ring)
+{
+  const Point &M    = verts[m];
+  const int    size = static_cast<int>(ring.size());
+
+    /*
+     * Find the nearest side of the ring crossed by the ray from M towards
+     * +x (only sides running up, as the inside of the ring lies to their
+     * left), and the end of it furthest right.
+     */
+  double hitX = std::numeric_limits<double>::max();
+  int    hit  = -1;
+  for (int i = 0; i < size; ++i)
+  {
+    const Point &A = verts[ring[i]];
+    const Point &B = verts[ring[(i + 1) % size]];
+    if (!((A.y <= M.y) && (M.y <= B.y) && (A.y < B.y)))
+      continue;
+    const double x = (A.x + (((static_cast<double>(M.y) - A.y) *
+                              (static_cast<double>(B.x) - A.x)) / (static_cast<double>(B.y) - A.y)));
+    if ((x < M.x) || (hitX <= x))
+      continue;
+    hitX = x;
+    if (A.y == M.y)
+      hit = i;
+    else if (B.y == M.y)
+      hit = ((i + 1) % size);
+    else
+      hit = ((A.x < B.x) ? ((i + 1) % size) : i);
+  }
+  if (hit < 0)
+    return false;
+
+    /*
+     * The ring may still cut between M and that end; if so, join to the
+     * corner poking furthest in (the reflex vertex inside the triangle M, the
+     * hit and that end closest in angle to the ray).
+     */
+  const Point  I(static_cast<float>(hitX), M.y);
+  const Point  P    = verts[ring[hit]];
+  const bool   ccw  = (0.0 < Cross(M, I, P));
+  double       best = std::numeric_limits<double>::max();
+  for (int i = 0; i < size; ++i)
+  {
+    const Point &R = verts[ring[i]];
+    if ((i == hit) || SamePoint(R, P) || (R.x <= M.x))
+      continue;
+    if (!(ccw ? InTriangle(R, M, I, P) : InTriangle(R, M, P, I)))
+      continue;
+    if (!(Cross(verts[ring[(i + size - 1) % size]], R, verts[ring[(i + 1) % size]]) < 0.0))
+      continue;
+    const double slope = (std::fabs(static_cast<double>(R.y) - M.y) /
+                          (static_cast<double>(R.x) - M.x));
+    if (slope < best)
+    {
+      best = slope;
+      hit  = i;
+    }
+  }
+
+    /* Splice the hole in after the vertex joined to: M, the hole, M again, and it again. */
+  const int count = (end - first);
+  const int start = ring[hit];
+  ring.insert((ring.begin() + hit + 1), (count + 2), m);
+  for (int k = 1; k < count; ++k)
+    ring[hit + 1 + k] = (first + ((m - first + (reversed ? (count - k) : k)) % count));
+  ring[hit + count + 2] = start;
+  return true;
+}
+
+  /* Build [layout] out of the polygon (see BuildMeshLayout()), using [scratch]. */
+static bool BuildLayout(const Point      *pPoints,
+                        const int        *pContourEnds,
+                              int         contourCount,
+                              int         pointStart,
+                              MeshLayout &layout,
+                              EarScratch &scratch)
+{
+  layout.Clear();
+  if (contourCount < 1)
+    return false;
+
+  const int pointCount = (pContourEnds[contourCount - 1] - pointStart);
+  layout.mVertices.assign(pPoints, (pPoints + pointCount));
+  const std::vector<Point> &verts = layout.mVertices;
+
+    /* The box bounding the vertices. */
+  if (pointCount)
+  {
+    Point lo = verts[0];
+    Point hi = verts[0];
+    for (int i = 1; i < pointCount; ++i)
+    {
+      lo = Point(std::min(lo.x, verts[i].x), std::min(lo.y, verts[i].y));
+      hi = Point(std::max(hi.x, verts[i].x), std::max(hi.y, verts[i].y));
+    }
+    layout.mDimensions = Vector((hi.x - lo.x), (hi.y - lo.y));
+    layout.mCenter     = Point((0.5f * (lo.x + hi.x)), (0.5f * (lo.y + hi.y)));
+  }
+
+    /*
+     * The edges are the sides of the contours, as given. The outline runs
+     * along them too, the boundary counterclockwise and the holes clockwise.
+     */
+  scratch.mRing.clear();
+  scratch.mHoles.clear();
+  int first = 0;
+  for (int c = 0; c < contourCount; ++c)
+  {
+    const int    end      = (pContourEnds[c] - pointStart);
+    const double area     = ContourArea(verts, first, end);
+    const bool   reversed = ((c == 0) ? (area < 0.0) : (0.0 < area));
+    for (int i = first; i < end; ++i)
+    {
+      const int j = (((i + 1) < end) ? (i + 1) : first);
+      layout.mEdges.push_back(Mesh::Edge(i, j));
+      layout.mOutline.push_back(reversed ? j : i);
+      layout.mOutline.push_back(reversed ? i : j);
+    }
+    if ((c == 0) && (3 <= (end - first)))
+      for (int i = first; i < end; ++i)
+        scratch.mRing.push_back(reversed ? (end - 1 - (i - first)) : i);
+    if ((c != 0) && (3 <= (end - first)) && (area != 0.0))
+    {
+      HoleInfo hole = { verts[first].x, c, first };
+      for (int i = (first + 1); i < end; ++i)
+        if (hole.mX < verts[i].x)
+        {
+          hole.mX         = verts[i].x;
+          hole.mRightmost = i;
+        }
+      scratch.mHoles.push_back(hole);
+    }
+    first = end;
+  }
+  if (scratch.mRing.size() < 3)
+    return false;
+
+    /* Join the holes to the ring, rightmost first. */
+  std::sort(scratch.mHoles.begin(), scratch.mHoles.end(),
+            [] (const HoleInfo &lhs, const HoleInfo &rhs) { return (rhs.mX < lhs.mX); } );
+  for (std::size_t h = 0; h < scratch.mHoles.size(); ++h)
+  {
+    const HoleInfo &hole     = scratch.mHoles[h];
+    const int       hFirst   = (pContourEnds[hole.mContour - 1] - pointStart);
+    const int       hEnd     = (pContourEnds[hole.mContour] - pointStart);
+    const bool      reversed = (0.0 < ContourArea(verts, hFirst, hEnd));
+    if (!JoinHole(verts, hFirst, hEnd, reversed, hole.mRightmost, scratch.mRing))
+    {
+      layout.mFaces.clear();
+      return false;
+    }
+  }
+
+    /* Clip the ring's ears. */
+  const std::vector<int> &ring  = scratch.mRing;
+  std::vector<int>       &prev  = scratch.mPrev;
+  std::vector<int>       &next  = scratch.mNext;
+  int                     count = static_cast<int>(ring.size());
+  prev.resize(count);
+  next.resize(count);
+  for (int i = 0; i < count; ++i)
+  {
+    prev[i] = ((i + count - 1) % count);
+    next[i] = ((i + 1) % count);
+  }
+  int b      = 0;
+  int misses = 0;
+  while (3 < count)
+  {
+    const int    a    = prev[b];
+    const int    c    = next[b];
+    const Point &A    = verts[ring[a]];
+    const Point &B    = verts[ring[b]];
+    const Point &C    = verts[ring[c]];
+    const double area = Cross(A, B, C);
+    bool         ear  = (0.0 <= area);
+      /* Corners with area are only ears when no other vertex lies in them. */
+    for (int p = next[c]; ear && (0.0 < area) && (p != a); p = next[p])
+    {
+      const Point &R = verts[ring[p]];
+      ear = (SamePoint(R, A) || SamePoint(R, B) || SamePoint(R, C) || !InTriangle(R, A, B, C));
+    }
+    if (!ear)
+    {
+        /*
+         * A ring that is not simple (or that rounding has pinched) may have
+         * no ear left; once round it without one, cut the next convex corner
+         * off anyway.
+         */
+      if ((++misses <= count) || !(0.0 < area))
+      {
+        if ((2 * count) < misses)
+        {
+          layout.mFaces.clear();
+          return false;
+        }
+        b = c;
+        continue;
+      }
+    }
+    if (0.0 < area)
+      layout.mFaces.push_back(Mesh::Face(ring[a], ring[b], ring[c]));
+    next[a] = c;
+    prev[c] = a;
+    --count;
+    b       = c;
+    misses  = 0;
+  }
+  if (0.0 < Cross(verts[ring[prev[b]]], verts[ring[b]], verts[ring[next[b]]]))
+    layout.mFaces.push_back(Mesh::Face(ring[prev[b]], ring[b], ring[next[b]]));
+  return true;
+}
+
+
+/*############################################################################*/
+/*######################### Function Implementation ##########################*/
+/*############################################################################*/
+
+  /* Empty edges and faces, for the base class of a PackedMesh. */
+const std::vector<Mesh::Edge> PackedMesh::mNoEdges;
+const std::vector<Mesh::Face> PackedMesh::mNoFaces;
+
+/*!
+******************************************************************************
+  \fn bool BuildMeshLayout(const Point *pPoints, const int *pContourEnds,
+                           int contourCount, MeshLayout &layout)
+
+  \brief
+    Build the layout of a mesh out of a simple polygon (a boundary and any
+    holes in it), triangulating it by ear clipping.
+
+  \param pPoints
+    The points of every contour, one contour after the other.
+
+  \param pContourEnds
+    One past the index of the last point of each contour (the first being
+    the boundary, the rest holes).
+
+  \param contourCount
+    The number of contours.
+
+  \param layout
+    The layout to build.
+
+  \return
+    Whether the polygon could be triangulated.
+*******************************************************************************/
+bool BuildMeshLayout(const Point      *pPoints,
+                     const int        *pContourEnds,
+                           int         contourCount,
+                           MeshLayout &layout)
+{
+  EarScratch scratch;
+  return BuildLayout(pPoints, pContourEnds, contourCount, 0, layout, scratch);
+}
+
+/*!
+******************************************************************************
+  \fn int BuildMeshLayouts(const Point *pPoints, const int *pContourEnds,
+                           const int *pPolygonEnds, int polygonCount,
+                           MeshLayout *pLayouts, TaskPool *pPool)
+
+  \brief
+    Build the layouts of many meshes at once, each out of a simple polygon,
+    split across the threads of a TaskPool.
+
+  \param pPoints
+    The points of every contour of every polygon, one after the other.
+
+  \param pContourEnds
+    One past the index of the last point of each contour.
+
+  \param pPolygonEnds
+    One past the index of the last contour of each polygon.
+
+  \param polygonCount
+    The number of polygons.
+
+  \param pLayouts
+    The layouts to build, one per polygon.
+
+  \param pPool
+    Optional TaskPool used to build the layouts in parallel.
+
+  \return
+    The number of polygons that could be triangulated.
+*******************************************************************************/
+int BuildMeshLayouts(const Point      *pPoints,
+                     const int        *pContourEnds,
+                     const int        *pPolygonEnds,
+                           int         polygonCount,
+                           MeshLayout *pLayouts,
+                           TaskPool   *pPool)
+{
+  std::vector<int> built(pPool ? pPool->ThreadCount() : 1, 0);
+
+  const TaskPool::RangeFn buildRange = [&] (int begin, int end, int thread)
+  {
+    EarScratch scratch;
+    for (int p = begin; p < end; ++p)
+    {
+      const int cBegin     = (p ? pPolygonEnds[p - 1] : 0);
+      const int pointStart = (cBegin ? pContourEnds[cBegin - 1] : 0);
+      if (BuildLayout((pPoints + pointStart), (pContourEnds + cBegin),
+                      (pPolygonEnds[p] - cBegin), pointStart, pLayouts[p], scratch))
+        ++built[thread];
+    }
+  };
+  if (pPool)
+    pPool->ParallelFor(polygonCount, buildRange, gMinPolygonsPerThread);
+  else
+    buildRange(0, polygonCount, 0);
+
+  int total = 0;
+  for (std::size_t t = 0; t < built.size(); ++t)
+    total += built[t];
+  return total;
+}
+
+
+/*!
+******************************************************************************
+  \fn void CopyMeshLayout(MyMesh &mesh, MeshLayout &layout)
+
+  \brief
+    Copy the layout of a mesh (whichever class holds it) into a mesh layout.
+
+  \param mesh
+    The mesh to copy.
+
+  \param layout
+    The layout copied into.
+*******************************************************************************/
+void CopyMeshLayout(MyMesh &mesh, MeshLayout &layout)
+{
+  layout.Clear();
+  for (int v = 0; v < mesh.VertexCount(); ++v)
+    layout.mVertices.push_back(mesh.GetVertex(v));
+  for (int e = 0; e < mesh.EdgeCount(); ++e)
+    layout.mEdges.push_back(mesh.GetEdge(e));
+  for (int f = 0; f < mesh.FaceCount(); ++f)
+    layout.mFaces.push_back(mesh.GetFace(f));
+  layout.mOutline    = mesh.Outline();
+  layout.mDimensions = mesh.Dimensions();
+  layout.mCenter     = mesh.Center();
+}
+
+/*!
+******************************************************************************
+  \fn void OptimizeMeshLayout(MeshLayout &layout, MeshOptimizeReport *pReport)
+
+  \brief
+    Drop the degenerate and repeated faces and edges of a mesh layout and
+    the vertices it does not use, and reorder the rest so that they are
+    walked nearly in order while transforming and drawing.
+
+  \param layout
+    The layout to optimize.
+
+  \param pReport
+    Optional report of what was dropped, where the vertices moved, and the
+    memory the layout takes before and after (packed).
+*******************************************************************************/
+void OptimizeMeshLayout(MeshLayout         &layout,
+                        MeshOptimizeReport *pReport)
+{
+  const std::vector<Point> &verts     = layout.mVertices;
+  const int                 vertCount = static_cast<int>(verts.size());
+  const int                 faceCount = static_cast<int>(layout.mFaces.size());
+  const int                 edgeCount = static_cast<int>(layout.mEdges.size());
+  const std::size_t         before    = ((verts.size() * sizeof(Point)) +
+                                         (layout.mEdges.size() * sizeof(Mesh::Edge)) +
+                                         (layout.mFaces.size() * sizeof(Mesh::Face)) +
+                                         (layout.mOutline.size() * sizeof(int)));
+
+    /* Drop the degenerate faces, then the faces repeating another's corners. */
+  std::vector<bool>     dropped(faceCount, false);
+  std::vector<IndexKey> keys;
+  for (int f = 0; f < faceCount; ++f)
+  {
+    const Mesh::Face &face = layout.mFaces[f];
+    dropped[f] = ((face.index1 == face.index2) || (face.index2 == face.index3) ||
+                  (face.index3 == face.index1) ||
+                  (Cross(verts[face.index1], verts[face.index2], verts[face.index3]) == 0.0));
+    if (!dropped[f])
+      keys.push_back(MakeKey(face.index1, face.index2, face.index3, f));
+  }
+  MarkRepeats(keys, dropped);
+  std::vector<Mesh::Face> faces;
+  for (int f = 0; f < faceCount; ++f)
+    if (!dropped[f])
+      faces.push_back(layout.mFaces[f]);
+
+    /* The same for the edges. */
+  dropped.assign(edgeCount, false);
+  keys.clear();
+  for (int e = 0; e < edgeCount; ++e)
+  {
+    const Mesh::Edge &edge = layout.mEdges[e];
+    dropped[e] = ((edge.index1 == edge.index2) || SamePoint(verts[edge.index1], verts[edge.index2]));
+    if (!dropped[e])
+      keys.push_back(MakeKey(edge.index1, edge.index2, -1, e));
+  }
+  MarkRepeats(keys, dropped);
+  std::vector<Mesh::Edge> edges;
+  for (int e = 0; e < edgeCount; ++e)
+    if (!dropped[e])
+      edges.push_back(layout.mEdges[e]);
+
+    /*
+     * Link each face to the faces sharing its sides (side s of face f being
+     * from corner s to the next), through keys made of the sides.
+     */
+  const int        keptFaces = static_cast<int>(faces.size());
+  std::vector<int> neighbors((3 * keptFaces), -1);
+  keys.clear();
+  for (int f = 0; f < keptFaces; ++f)
+  {
+    const int corners[3] = { faces[f].index1, faces[f].index2, faces[f].index3 };
+    for (int s = 0; s < 3; ++s)
+      keys.push_back(MakeKey(corners[s], corners[(s + 1) % 3], -1, ((3 * f) + s)));
+  }
+  std::sort(keys.begin(), keys.end());
+  for (std::size_t k = 1; k < keys.size(); ++k)
+    if (keys[k].SameIndices(keys[k - 1]))
+    {
+      neighbors[keys[k].mPrimitive]     = (keys[k - 1].mPrimitive / 3);
+      neighbors[keys[k - 1].mPrimitive] = (keys[k].mPrimitive / 3);
+    }
+
+    /* Walk the faces breadth first across the sides they share. */
+  std::vector<int>  order;
+  std::vector<bool> reached(keptFaces, false);
+  order.reserve(keptFaces);
+  for (int start = 0; start < keptFaces; ++start)
+  {
+    if (reached[start])
+      continue;
+    reached[start] = true;
+    order.push_back(start);
+    for (std::size_t o = (order.size() - 1); o < order.size(); ++o)
+      for (int s = 0; s < 3; ++s)
+      {
+        const int n = neighbors[(3 * order[o]) + s];
+        if ((0 <= n) && !reached[n])
+        {
+          reached[n] = true;
+          order.push_back(n);
+        }
+      }
+  }
+
+    /*
+     * Number the vertices in the order the faces, then the edges, then the
+     * outline first use them (the outline only using vertices of the faces,
+     * unless given otherwise).
+     */
+  std::vector<int> vertexMap(vertCount, -1);
+  int              kept = 0;
+  for (int o = 0; o < keptFaces; ++o)
+  {
+    const Mesh::Face &face = faces[order[o]];
+    const int corners[3] = { face.index1, face.index2, face.index3 };
+    for (int c = 0; c < 3; ++c)
+      if (vertexMap[corners[c]] < 0)
+        vertexMap[corners[c]] = kept++;
+  }
+  for (std::size_t e = 0; e < edges.size(); ++e)
+  {
+    if (vertexMap[edges[e].index1] < 0)
+      vertexMap[edges[e].index1] = kept++;
+    if (vertexMap[edges[e].index2] < 0)
+      vertexMap[edges[e].index2] = kept++;
+  }
+  for (std::size_t i = 0; i < layout.mOutline.size(); ++i)
+    if (vertexMap[layout.mOutline[i]] < 0)
+      vertexMap[layout.mOutline[i]] = kept++;
+
+    /* Rebuild the layout in the new order. */
+  std::vector<Point> newVerts(kept);
+  for (int v = 0; v < vertCount; ++v)
+    if (0 <= vertexMap[v])
+      newVerts[vertexMap[v]] = verts[v];
+  layout.mFaces.clear();
+  for (int o = 0; o < keptFaces; ++o)
+  {
+    const Mesh::Face &face = faces[order[o]];
+    layout.mFaces.push_back(Mesh::Face(vertexMap[face.index1], vertexMap[face.index2],
+                                       vertexMap[face.index3]));
+  }
+  layout.mEdges.clear();
+  for (std::size_t e = 0; e < edges.size(); ++e)
+    layout.mEdges.push_back(Mesh::Edge(vertexMap[edges[e].index1], vertexMap[edges[e].index2]));
+  for (std::size_t i = 0; i < layout.mOutline.size(); ++i)
+    layout.mOutline[i] = vertexMap[layout.mOutline[i]];
+  layout.mVertices.swap(newVerts);
+
+  if (pReport)
+  {
+    pReport->mDroppedVertices = (vertCount - kept);
+    pReport->mDroppedEdges    = (edgeCount - static_cast<int>(edges.size()));
+    pReport->mDroppedFaces    = (faceCount - keptFaces);
+    pReport->mVertexMap.swap(vertexMap);
+    pReport->mBytesBefore     = before;
+    pReport->mBytesAfter      = PackedBytes(layout);
+  }
+}
+
+/*!
+******************************************************************************
+  \fn std::size_t PackMeshLayout(const MeshLayout &layout,
+                                 PackedMeshLayout &packed)
+
+  \brief
+    Pack the edges and faces of a mesh layout into one list of indices, 16
+    bits each when they fit.
+
+  \param layout
+    The layout to pack.
+
+  \param packed
+    The packed layout.
+
+  \return
+    The bytes the packed layout's data takes.
+*******************************************************************************/
+std::size_t PackMeshLayout(const MeshLayout       &layout,
+                                 PackedMeshLayout &packed)
+{
+  packed.mVertices   = layout.mVertices;
+  packed.mOutline    = layout.mOutline;
+  packed.mDimensions = layout.mDimensions;
+  packed.mCenter     = layout.mCenter;
+  packed.mEdgeCount  = static_cast<int>(layout.mEdges.size());
+  packed.mFaceCount  = static_cast<int>(layout.mFaces.size());
+
+  std::vector<int> indices;
+  indices.reserve((2 * layout.mEdges.size()) + (3 * layout.mFaces.size()));
+  for (std::size_t e = 0; e < layout.mEdges.size(); ++e)
+  {
+    indices.push_back(layout.mEdges[e].index1);
+    indices.push_back(layout.mEdges[e].index2);
+  }
+  for (std::size_t f = 0; f < layout.mFaces.size(); ++f)
+  {
+    indices.push_back(layout.mFaces[f].index1);
+    indices.push_back(layout.mFaces[f].index2);
+    indices.push_back(layout.mFaces[f].index3);
+  }
+
+  packed.mShortIndices.clear();
+  packed.mIndices.clear();
+  if (static_cast<int>(layout.mVertices.size()) <= gShortIndexLimit)
+    packed.mShortIndices.assign(indices.begin(), indices.end());
+  else
+    packed.mIndices.swap(indices);
+  return PackedBytes(layout);
+}
@@ -0,0 +1,245 @@
+/*!
+*****************************************************************************
+\file   MeshBuilder.h
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the definitions of the MeshLayout and
+  PackedMeshLayout structs and the LayoutMesh and PackedMesh classes, and the
+  prototypes of the functions that build mesh layouts (vertices, edges and
+  faces) out of polygons and optimize them.
+*******************************************************************************/
+#ifndef MESHBUILDER_H
+#define MESHBUILDER_H
+
+#include "MyMesh.h"
+#include "TaskPool.h"
+#include <vector>
+
+
+/*!
+******************************************************************************
+  \struct MeshLayout
+
+  \brief
+    The layout of a mesh built at run time (where the derived mesh classes
+    keep theirs in static storage): its vertices, edges and faces, the
+    outline of its faces (see MeshOutline()) and the box bounding it.
+*******************************************************************************/
+struct MeshLayout
+{
+  std::vector<Point>      mVertices;
+  std::vector<Mesh::Edge> mEdges;
+  std::vector<Mesh::Face> mFaces;
+  std::vector<int>        mOutline;
+    /* The size and center of the box bounding the vertices. */
+  Vector                  mDimensions;
+  Point                   mCenter;
+
+    /* Empty the layout. */
+  void Clear(void)
+  {
+    mVertices.clear();
+    mEdges.clear();
+    mFaces.clear();
+    mOutline.clear();
+    mDimensions = Vector(0.0f, 0.0f);
+    mCenter     = Point(0.0f, 0.0f);
+  }
+};
+
+
+/*!
+******************************************************************************
+  \struct PackedMeshLayout
+
+  \brief
+    A MeshLayout with its edges and faces packed into one list of indices
+    (the edges' pairs, then the faces' triples), 16 bits each when every
+    vertex index fits in 16 bits and 32 bits otherwise.
+*******************************************************************************/
+struct PackedMeshLayout
+{
+  std::vector<Point>          mVertices;
+    /* The indices, in whichever of the two lists is in use (the other is empty). */
+  std::vector<unsigned short> mShortIndices;
+  std::vector<int>            mIndices;
+  int                         mEdgeCount;
+  int                         mFaceCount;
+  std::vector<int>            mOutline;
+    /* The size and center of the box bounding the vertices. */
+  Vector                      mDimensions;
+  Point                       mCenter;
+
+    /* Default Constructor. */
+  PackedMeshLayout(void)
+    : mVertices(), mShortIndices(), mIndices(), mEdgeCount(0), mFaceCount(0),
+      mOutline(), mDimensions(0.0f, 0.0f), mCenter(0.0f, 0.0f) { ; }
+
+    /* Get the i_th index (the edges' first, then the faces'). */
+  int Index(int i) const
+  { return (mIndices.empty() ? static_cast<int>(mShortIndices[i]) : mIndices[i]); }
+};
+
+
+/*!
+******************************************************************************
+  \struct MeshOptimizeReport
+
+  \brief
+    What OptimizeMeshLayout() dropped from a layout, where it moved the
+    vertices, and the memory the layout takes before and after (packed).
+*******************************************************************************/
+struct MeshOptimizeReport
+{
+  int              mDroppedVertices;
+  int              mDroppedEdges;
+  int              mDroppedFaces;
+    /* The new index of each vertex as given (-1 for those dropped). */
+  std::vector<int> mVertexMap;
+    /* The bytes of the layout's data as given, and once optimized and packed. */
+  std::size_t      mBytesBefore;
+  std::size_t      mBytesAfter;
+};
+
+
+/*!
+******************************************************************************
+  \class LayoutMesh : public MyMesh
+
+  \brief
+    This class is a derived Mesh made of a MeshLayout, which must outlive it
+    (and stay unchanged) as the mesh refers to it rather than copying it.
+*******************************************************************************/
+class LayoutMesh : public MyMesh
+{
+/*############################################################################*/
+/*############################## Public Methods ##############################*/
+/*############################################################################*/
+public:
+
+  /******************************* Constructors *******************************/
+    /* Non-Default Constructor. */
+  explicit LayoutMesh(const MeshLayout &layout)
+    : MyMesh(layout.mVertices, layout.mEdges, layout.mFaces, layout.mOutline,
+             layout.mDimensions, layout.mCenter) { ; }
+    /* Default Destructor. */
+  virtual ~LayoutMesh(void) { ; }
+};
+
+
+/*!
+******************************************************************************
+  \class PackedMesh : public MyMesh
+
+  \brief
+    This class is a derived Mesh made of a PackedMeshLayout, which must
+    outlive it (and stay unchanged) as the mesh refers to it rather than
+    copying it. Its edges and faces are unpacked as they are accessed.
+*******************************************************************************/
+class PackedMesh : public MyMesh
+{
+/*############################################################################*/
+/*############################## Public Methods ##############################*/
+/*############################################################################*/
+public:
+
+  /******************************* Constructors *******************************/
+    /* Non-Default Constructor. */
+  explicit PackedMesh(const PackedMeshLayout &layout)
+    : MyMesh(layout.mVertices, mNoEdges, mNoFaces, layout.mOutline,
+             layout.mDimensions, layout.mCenter),
+      mrLayout(layout) { ; }
+    /* Default Destructor. */
+  virtual ~PackedMesh(void) { ; }
+
+  /********************************* Getters **********************************/
+    /* Get the number of edges in of the mesh. */
+  int EdgeCount(void) { return mrLayout.mEdgeCount; }
+    /* Get the number of faces in of the mesh. */
+  int FaceCount(void) { return mrLayout.mFaceCount; }
+
+  /******************************** Accessors *********************************/
+    /* Access the i_th edge of the mesh. */
+  Edge GetEdge(int i)
+  { return Edge(mrLayout.Index(2 * i), mrLayout.Index((2 * i) + 1)); }
+    /* Access the i_th face of the mesh. */
+  Face GetFace(int i)
+  {
+    const int first = ((2 * mrLayout.mEdgeCount) + (3 * i));
+    return Face(mrLayout.Index(first), mrLayout.Index(first + 1), mrLayout.Index(first + 2));
+  }
+
+/*############################################################################*/
+/*############################# Private Members ##############################*/
+/*############################################################################*/
+private:
+    /* The layout the mesh is made of. */
+  const PackedMeshLayout &mrLayout;
+    /* Empty edges and faces, for the base class (the layout holds them packed). */
+  static const std::vector<Edge> mNoEdges;
+  static const std::vector<Face> mNoFaces;
+};
+
+
+/*############################################################################*/
+/*########################### Function Prototypes ############################*/
+/*############################################################################*/
+
+  /*
+   * Build the layout of a mesh out of the simple polygon made of the
+   * [contourCount] closed contours of the points at [pPoints], contour c
+   * ending just before point [pContourEnds][c]: the first contour is the
+   * polygon's boundary, and any others are holes in it. The vertices are the
+   * points, the edges are the sides of the contours, and the faces
+   * triangulate the polygon (by ear clipping). Returns whether the polygon
+   * could be triangulated; if not, [layout] is left with no faces.
+   */
+bool BuildMeshLayout(const Point      *pPoints,
+                     const int        *pContourEnds,
+                           int         contourCount,
+                           MeshLayout &layout);
+  /*
+   * Build the layouts of [polygonCount] meshes at once (as BuildMeshLayout()
+   * does), split across [pPool] when given. Polygon p is made of the
+   * contours before contour [pPolygonEnds][p] (and from where the polygon
+   * before it ends), whose points are all at [pPoints] as for
+   * BuildMeshLayout(). Returns the number of polygons triangulated.
+   */
+int BuildMeshLayouts(const Point      *pPoints,
+                     const int        *pContourEnds,
+                     const int        *pPolygonEnds,
+                           int         polygonCount,
+                           MeshLayout *pLayouts,
+                           TaskPool   *pPool = NULL);
+  /*
+   * Copy the vertices, edges, faces, outline, dimensions and center of
+   * [mesh] into [layout] (e.g. to optimize a mesh kept in static storage).
+   */
+void CopyMeshLayout(MyMesh &mesh, MeshLayout &layout);
+  /*
+   * Optimize [layout] in place: drop degenerate faces (two corners on the
+   * same vertex, or no area), faces repeating another's corners, degenerate
+   * edges and edges repeating another (either way round), and vertices no
+   * edge or face uses. The faces are then reordered so that faces sharing a
+   * side come close together, and the vertices in the order those faces
+   * (then the edges) first use them, so that transforming and drawing walk
+   * them nearly in order; the outline is renumbered to match. Fills
+   * [pReport] when given.
+   */
+void OptimizeMeshLayout(MeshLayout         &layout,
+                        MeshOptimizeReport *pReport = NULL);
+  /*
+   * Pack [layout] into [packed], with 16 bit indices when it has no more
+   * than 65536 vertices. Returns the bytes the packed layout's data takes.
+   */
+std::size_t PackMeshLayout(const MeshLayout       &layout,
+                                 PackedMeshLayout &packed);
+
+
+#endif
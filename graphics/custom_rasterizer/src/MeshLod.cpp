@@ -0,0 +1,501 @@
+/*!
+*****************************************************************************
+\file   MeshLod.cpp
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the implementation of BuildMeshLod.
+
+  The outline of the mesh's faces is walked into closed loops, and its edges
+  into chains running between the vertices where they branch or end (or
+  into closed loops, where they never do). Each level then simplifies every
+  loop and chain by Douglas-Peucker: a run is replaced by the segment
+  joining its ends unless one of its vertices lies further than the level's
+  tolerance from that segment, in which case the furthest vertex is kept and
+  both halves are simplified again. The loops of the outline are then
+  triangulated again, the largest being the boundary and the rest holes,
+  and the triangulation is only trusted if its area is that of the loops,
+  and no loop has lost much of its own area (collapsing to a sliver or a
+  line, which would leave nothing to fill).
+*******************************************************************************/
+#include "MeshLod.h"
+#include "MeshBuilder.h"
+#include <algorithm>
+#include <cmath>
+
+
+/*############################################################################*/
+/*############################# Global Constants #############################*/
+/*############################################################################*/
+
+  /*
+   * The tolerance (as a fraction of the mesh's radius) of the finest level
+   * simplified, each level after it doubling it, and the number of levels
+   * tried.
+   */
+static const float gFinestLodTolerance = (1.0f / 64.0f);
+static const int   gLodTries           = 6;
+  /*
+   * The fraction of its area every loop of the outline must keep for a
+   * level's faces to be used (otherwise the faces before it are kept).
+   */
+static const double gMinLoopAreaKept   = 0.5;
+
+
+/*############################################################################*/
+/*########################## Local Helper Functions ##########################*/
+/*############################################################################*/
+
+  /* A run of the mesh's vertices, either closed into a loop or open. */
+struct VertexRun
+{
+  std::vector<int> mVertices;
+    /* The edge joining each vertex to the next (open runs only). */
+  std::vector<int> mEdges;
+  bool             mClosed;
+};
+
+  /* The distance from [P] to the segment [A][B]. */
+static double SegmentDistance(const Point &P, const Point &A, const Point &B)
+{
+  const double dx  = (static_cast<double>(B.x) - A.x);
+  const double dy  = (static_cast<double>(B.y) - A.y);
+  const double px  = (static_cast<double>(P.x) - A.x);
+  const double py  = (static_cast<double>(P.y) - A.y);
+  const double len = ((dx * dx) + (dy * dy));
+  const double t   = ((0.0 < len) ? std::max(0.0, std::min(1.0, (((px * dx) + (py * dy)) / len))) : 0.0);
+  return std::hypot((px - (t * dx)), (py - (t * dy)));
+}
+
+  /*
+   * Simplify the run of [pts] from [first] to [last] (indices taken modulo
+   * the run's size, so that loops can wrap), marking the points kept in
+   * [keep] and raising [error] to the furthest a dropped point strays.
+   */
+static void SimplifyRun(const std::vector<Point> &pts,
+                              int                 first,
+                              int                 last,
+                              double              tolerance,
+                              std::vector<bool>  &keep,
+                              double             &error)
+{
+  const int size = static_cast<int>(pts.size());
+  std::vector<std::pair<int, int> > pending(1, std::make_pair(first, last));
+  while (!pending.empty())
+  {
+    const int a = pending.back().first;
+    const int b = pending.back().second;
+    pending.pop_back();
+    double furthest = 0.0;
+    int    k        = -1;
+    for (int i = (a + 1); i < b; ++i)
+    {
+      const double d = SegmentDistance(pts[i % size], pts[a % size], pts[b % size]);
+      if (furthest < d)
+      {
+        furthest = d;
+        k        = i;
+      }
+    }
+    if (k < 0)
+      continue;
+    if (furthest <= tolerance)
+    {
+      error = std::max(error, furthest);
+      continue;
+    }
+    keep[k % size] = true;
+    pending.push_back(std::make_pair(a, k));
+    pending.push_back(std::make_pair(k, b));
+  }
+}
+
+  /*
+   * Simplify [run] of [verts] to [tolerance], marking the points kept in
+   * [keep] and raising [error] to the furthest a dropped one strays. Loops
+   * keep at least three points.
+   */
+static void SimplifyVertexRun(const std::vector<Point> &verts,
+                              const VertexRun          &run,
+                                    double              tolerance,
+                                    std::vector<bool>  &keep,
+                                    double             &error)
+{
+  const int          size = static_cast<int>(run.mVertices.size());
+  std::vector<Point> pts;
+  for (int i = 0; i < size; ++i)
+    pts.push_back(verts[run.mVertices[i]]);
+  keep.assign(size, false);
+  keep[0] = true;
+  if (!run.mClosed)
+  {
+    keep[size - 1] = true;
+    SimplifyRun(pts, 0, (size - 1), tolerance, keep, error);
+    return;
+  }
+  if (size <= 3)
+  {
+    keep.assign(size, true);
+    return;
+  }
+
+    /* Split the loop at the point furthest from the first. */
+  int far = 1;
+  for (int i = 2; i < size; ++i)
+    if (std::hypot((pts[i].x - pts[0].x), (pts[i].y - pts[0].y)) >
+        std::hypot((pts[far].x - pts[0].x), (pts[far].y - pts[0].y)))
+      far = i;
+  keep[far] = true;
+  double loopError = 0.0;
+  SimplifyRun(pts, 0, far, tolerance, keep, loopError);
+  SimplifyRun(pts, far, size, tolerance, keep, loopError);
+  if (std::count(keep.begin(), keep.end(), true) < 3)
+  {
+      /* Too thin to keep any area: keep the point furthest from the split too. */
+    int    k        = 1;
+    double furthest = -1.0;
+    for (int i = 1; i < size; ++i)
+    {
+      const double d = SegmentDistance(pts[i], pts[0], pts[far]);
+      if ((i != far) && (furthest < d))
+      {
+        furthest = d;
+        k        = i;
+      }
+    }
+    keep[k]   = true;
+    loopError = 0.0;
+    const int split[3] = { 0, std::min(k, far), std::max(k, far) };
+    for (int s = 0; s < 3; ++s)
+      SimplifyRun(pts, split[s], ((s < 2) ? split[s + 1] : size), tolerance, keep, loopError);
+  }
+  error = std::max(error, loopError);
+}
+
+  /*
+   * Walk the [outline] (from, to pairs) into closed loops. Returns false when
+   * a vertex starts more than one of its edges, or the edges do not close
+   * into loops.
+   */
+static bool OutlineLoops(const std::vector<int>       &outline,
+                               int                     vertCount,
+                               std::vector<VertexRun> &loops)
+{
+  std::vector<int> next(vertCount, -1);
+  for (std::size_t i = 0; i < outline.size(); i += 2)
+  {
+    if (0 <= next[outline[i]])
+      return false;
+    next[outline[i]] = outline[i + 1];
+  }
+  std::vector<bool> visited(vertCount, false);
+  for (std::size_t i = 0; i < outline.size(); i += 2)
+  {
+    if (visited[outline[i]])
+      continue;
+    VertexRun loop;
+    loop.mClosed = true;
+    int v = outline[i];
+    for (/* v = outline[i] */; !visited[v]; v = next[v])
+    {
+      if (next[v] < 0)
+        return false;
+      visited[v] = true;
+      loop.mVertices.push_back(v);
+    }
+      /* Loops must close where they started. */
+    if ((v != outline[i]) || (loop.mVertices.size() < 3))
+      return false;
+    loops.push_back(loop);
+  }
+  return true;
+}
+
+  /*
+   * Walk the [edges] into runs between the vertices where they branch or end
+   * (and loops, for the edges with no such vertex).
+   */
+static void EdgeRuns(const std::vector<Mesh::Edge> &edges,
+                           int                      vertCount,
+                           std::vector<VertexRun>  &runs)
+{
+    /* The edges at each vertex, as (edge, other end) pairs. */
+  std::vector<std::vector<std::pair<int, int> > > links(vertCount);
+  for (std::size_t e = 0; e < edges.size(); ++e)
+  {
+    links[edges[e].index1].push_back(std::make_pair(static_cast<int>(e), edges[e].index2));
+    links[edges[e].index2].push_back(std::make_pair(static_cast<int>(e), edges[e].index1));
+  }
+
+  std::vector<bool> walked(edges.size(), false);
+    /* Runs start at the branches and ends first, then anywhere on the loops left. */
+  for (int pass = 0; pass < 2; ++pass)
+    for (int start = 0; start < vertCount; ++start)
+    {
+      if ((pass == 0) && (links[start].size() == 2))
+        continue;
+      for (std::size_t l = 0; l < links[start].size(); ++l)
+      {
+        if (walked[links[start][l].first])
+          continue;
+        VertexRun run;
+        run.mClosed = false;
+        run.mVertices.push_back(start);
+        int v = start;
+        int e = links[start][l].first;
+        for (;;)
+        {
+          walked[e] = true;
+          run.mEdges.push_back(e);
+          v = ((edges[e].index1 == v) ? edges[e].index2 : edges[e].index1);
+          run.mVertices.push_back(v);
+          if ((v == start) || (links[v].size() != 2))
+            break;
+          e = ((links[v][0].first == e) ? links[v][1].first : links[v][0].first);
+          if (walked[e])
+            break;
+        }
+        runs.push_back(run);
+      }
+    }
+}
+
+  /* Twice the signed area of the loop of [verts] indexed by [loop]. */
+static double LoopArea(const std::vector<Point> &verts, const std::vector<int> &loop)
+{
+  double area = 0.0;
+  for (std::size_t i = 0; i < loop.size(); ++i)
+  {
+    const Point &P = verts[loop[i]];
+    const Point &Q = verts[loop[((i + 1) < loop.size()) ? (i + 1) : 0]];
+    area += ((static_cast<double>(P.x) * Q.y) - (static_cast<double>(Q.x) * P.y));
+  }
+  return area;
+}
+
+  /*
+   * Simplify the outline [loops] of [verts] to [tolerance] and triangulate
+   * them into [level]'s faces and outline, raising [error] to the furthest a
+   * dropped vertex strays. Returns false when there are no loops, when a
+   * loop loses too much of its area (see gMinLoopAreaKept), or when the
+   * loops left cannot be triangulated.
+   */
+static bool SimplifyFaces(const std::vector<Point>     &verts,
+                          const std::vector<VertexRun> &loops,
+                                double                  tolerance,
+                                MeshLodLevel           &level,
+                                double                 &error)
+{
+  if (loops.empty())
+    return false;
+
+    /* The loops kept, largest first, as points and as indices of the mesh's vertices. */
+  std::vector<std::pair<double, std::vector<int> > > kept;
+  std::vector<bool> keep;
+  for (std::size_t l = 0; l < loops.size(); ++l)
+  {
+    SimplifyVertexRun(verts, loops[l], tolerance, keep, error);
+    std::vector<int> loop;
+    for (std::size_t i = 0; i < keep.size(); ++i)
+      if (keep[i])
+        loop.push_back(loops[l].mVertices[i]);
+    const double loopArea = std::fabs(LoopArea(verts, loop));
+    if ((loopArea == 0.0) ||
+        (loopArea < (gMinLoopAreaKept * std::fabs(LoopArea(verts, loops[l].mVertices)))))
+      return false;
+    kept.push_back(std::make_pair(-loopArea, loop));
+  }
+  std::stable_sort(kept.begin(), kept.end(),
+                   [] (const std::pair<double, std::vector<int> > &lhs,
+                       const std::pair<double, std::vector<int> > &rhs)
+                   { return (lhs.first < rhs.first); } );
+
+  std::vector<Point> points;
+  std::vector<int>   indices;
+  std::vector<int>   ends;
+  double             area = 0.0;
+  for (std::size_t l = 0; l < kept.size(); ++l)
+  {
+    for (std::size_t i = 0; i < kept[l].second.size(); ++i)
+    {
+      points.push_back(verts[kept[l].second[i]]);
+      indices.push_back(kept[l].second[i]);
+    }
+    ends.push_back(static_cast<int>(points.size()));
+    area += ((l == 0) ? -kept[l].first : kept[l].first);
+  }
+  MeshLayout layout;
+  if (!BuildMeshLayout(&points[0], &ends[0], static_cast<int>(ends.size()), layout))
+    return false;
+
+    /* Holes that cross the boundary (or each other) leave the area wrong. */
+  double faceArea = 0.0;
+  for (std::size_t f = 0; f < layout.mFaces.size(); ++f)
+  {
+    const Mesh::Face &face = layout.mFaces[f];
+    const Point      &P    = points[face.index1];
+    const Point      &Q    = points[face.index2];
+    const Point      &R    = points[face.index3];
+    faceArea += (((static_cast<double>(Q.x) - P.x) * (static_cast<double>(R.y) - P.y)) -
+                 ((static_cast<double>(Q.y) - P.y) * (static_cast<double>(R.x) - P.x)));
+  }
+  if (1e-6 * std::max(1.0, area) < std::fabs(faceArea - area))
+    return false;
+
+  level.mFaces.clear();
+  for (std::size_t f = 0; f < layout.mFaces.size(); ++f)
+    level.mFaces.push_back(Mesh::Face(indices[layout.mFaces[f].index1],
+                                      indices[layout.mFaces[f].index2],
+                                      indices[layout.mFaces[f].index3]));
+  level.mOutline.clear();
+  for (std::size_t i = 0; i < layout.mOutline.size(); ++i)
+    level.mOutline.push_back(indices[layout.mOutline[i]]);
+  return true;
+}
+
+  /*
+   * Simplify the edge [runs] of [verts] to [tolerance] into [level]'s edges,
+   * raising [error] to the furthest a dropped vertex strays. The edges left
+   * whole keep their direction.
+   */
+static void SimplifyEdges(const std::vector<Point>      &verts,
+                          const std::vector<Mesh::Edge> &edges,
+                          const std::vector<VertexRun>  &runs,
+                                double                   tolerance,
+                                MeshLodLevel            &level,
+                                double                  &error)
+{
+  std::vector<bool> keep;
+  level.mEdges.clear();
+  for (std::size_t r = 0; r < runs.size(); ++r)
+  {
+    const VertexRun &run = runs[r];
+    SimplifyVertexRun(verts, run, tolerance, keep, error);
+    int from = 0;
+    for (std::size_t i = 1; i < keep.size(); ++i)
+    {
+      if (!keep[i])
+        continue;
+      const int to = static_cast<int>(i);
+      if ((to - from) == 1)
+        level.mEdges.push_back(edges[run.mEdges[from]]);
+      else
+        level.mEdges.push_back(Mesh::Edge(run.mVertices[from], run.mVertices[to]));
+      from = to;
+    }
+  }
+}
+
+  /* Gather the vertices [level] uses, in order. */
+static void LevelVertices(MeshLodLevel &level, int vertCount)
+{
+  std::vector<bool> used(vertCount, false);
+  for (std::size_t f = 0; f < level.mFaces.size(); ++f)
+  {
+    used[level.mFaces[f].index1] = true;
+    used[level.mFaces[f].index2] = true;
+    used[level.mFaces[f].index3] = true;
+  }
+  for (std::size_t e = 0; e < level.mEdges.size(); ++e)
+  {
+    used[level.mEdges[e].index1] = true;
+    used[level.mEdges[e].index2] = true;
+  }
+  for (std::size_t i = 0; i < level.mOutline.size(); ++i)
+    used[level.mOutline[i]] = true;
+  level.mVertices.clear();
+  for (int v = 0; v < vertCount; ++v)
+    if (used[v])
+      level.mVertices.push_back(v);
+}
+
+
+/*############################################################################*/
+/*######################### Function Implementation ##########################*/
+/*############################################################################*/
+
+/*!
+******************************************************************************
+  \fn void BuildMeshLod(MyMesh &mesh, MeshLod &lod)
+
+  \brief
+    Build the levels of detail of a mesh, simplifying its outline and edges
+    further at each level.
+
+  \param mesh
+    The mesh to simplify.
+
+  \param lod
+    The levels of detail built.
+*******************************************************************************/
+void BuildMeshLod(MyMesh &mesh, MeshLod &lod)
+{
+  const int vertCount = mesh.VertexCount();
+  lod.mLevels.clear();
+  lod.mRadius = 0.0f;
+  if (vertCount == 0)
+    return;
+
+    /* Level 0 is the mesh as it is. */
+  std::vector<Point> verts;
+  for (int v = 0; v < vertCount; ++v)
+    verts.push_back(mesh.GetVertex(v));
+  MeshLodLevel full;
+  full.mError = 0.0f;
+  for (int f = 0; f < mesh.FaceCount(); ++f)
+    full.mFaces.push_back(mesh.GetFace(f));
+  for (int e = 0; e < mesh.EdgeCount(); ++e)
+    full.mEdges.push_back(mesh.GetEdge(e));
+  full.mOutline = mesh.Outline();
+  LevelVertices(full, vertCount);
+  lod.mLevels.push_back(full);
+
+    /* The radius is measured from the center of the vertices' bounds. */
+  Point lo = verts[0];
+  Point hi = verts[0];
+  for (int v = 1; v < vertCount; ++v)
+  {
+    lo = Point(std::min(lo.x, verts[v].x), std::min(lo.y, verts[v].y));
+    hi = Point(std::max(hi.x, verts[v].x), std::max(hi.y, verts[v].y));
+  }
+  const Point center((0.5f * (lo.x + hi.x)), (0.5f * (lo.y + hi.y)));
+  for (int v = 0; v < vertCount; ++v)
+    lod.mRadius = std::max(lod.mRadius, std::hypot((verts[v].x - center.x),
+                                                   (verts[v].y - center.y)));
+
+  std::vector<VertexRun> loops;
+  std::vector<VertexRun> runs;
+  bool simplifyFaces = OutlineLoops(full.mOutline, vertCount, loops);
+  EdgeRuns(full.mEdges, vertCount, runs);
+
+  double tolerance = (gFinestLodTolerance * lod.mRadius);
+  for (int t = 0; t < gLodTries; ++t, tolerance *= 2.0)
+  {
+    const MeshLodLevel &last  = lod.mLevels.back();
+    MeshLodLevel        level = last;
+    double              error = 0.0;
+      /* Once the outline cannot be simplified further, the last faces are kept. */
+    double faceError = 0.0;
+    if (simplifyFaces && SimplifyFaces(verts, loops, tolerance, level, faceError))
+      error = faceError;
+    else
+    {
+      simplifyFaces = false;
+      error         = last.mError;
+    }
+    SimplifyEdges(verts, full.mEdges, runs, tolerance, level, error);
+    LevelVertices(level, vertCount);
+      /* Coarser levels never claim to stray less than finer ones. */
+    level.mError = std::max(static_cast<float>(error), last.mError);
+
+      /* Only keep levels that draw less than the one before. */
+    if ((level.mFaces.size() + level.mEdges.size() + level.mOutline.size()) <
+        (last.mFaces.size()  + last.mEdges.size()  + last.mOutline.size()))
+      lod.mLevels.push_back(level);
+  }
+}
@@ -0,0 +1,114 @@
+/*!
+*****************************************************************************
+\file   MeshLod.h
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the definitions of the MeshLodLevel and MeshLod structs,
+  which hold simplified versions (levels of detail) of a mesh to draw in its
+  place when it is small on screen, and the prototype of BuildMeshLod.
+*******************************************************************************/
+#ifndef MESHLOD_H
+#define MESHLOD_H
+
+#include "MyMesh.h"
+#include <vector>
+
+
+/*############################################################################*/
+/*############################# Global Constants #############################*/
+/*############################################################################*/
+
+  /*
+   * The size (in pixels) under which an object is drawn as a filled box,
+   * and under which it is drawn as a single pixel.
+   */
+static const float gLodBoxPixels   = 3.0f;
+static const float gLodSplatPixels = 1.0f;
+
+
+/*!
+******************************************************************************
+  \struct MeshLodLevel
+
+  \brief
+    One level of detail of a mesh: the faces, edges and outline (see
+    MeshOutline()) to draw it with, all indexing the mesh's own vertices (so
+    that its vertex colors and texture coordinates still apply).
+*******************************************************************************/
+struct MeshLodLevel
+{
+    /* The most (in object space) the level strays from the mesh. */
+  float                   mError;
+    /* The vertices of the mesh the level uses, in order. */
+  std::vector<int>        mVertices;
+  std::vector<Mesh::Face> mFaces;
+  std::vector<Mesh::Edge> mEdges;
+  std::vector<int>        mOutline;
+};
+
+
+/*!
+******************************************************************************
+  \struct MeshLod
+
+  \brief
+    The levels of detail of a mesh, finest first (level 0 being the mesh as
+    it is), each with fewer faces and edges than the one before. Past the
+    last level come two more, drawn without the mesh: a box filling the
+    object's bounds, then a single pixel at its center.
+*******************************************************************************/
+struct MeshLod
+{
+  std::vector<MeshLodLevel> mLevels;
+    /* How far the mesh's vertices reach from the center of their bounds. */
+  float                     mRadius;
+
+    /* Default Constructor. */
+  MeshLod(void) : mLevels(), mRadius(0.0f) { ; }
+
+    /* Get the level drawn as a box (the one after that being a pixel). */
+  int BoxLevel(void) const { return static_cast<int>(mLevels.size()); }
+    /*
+     * Pick the level to draw the mesh at when scaled by [scale] (in pixels
+     * per object space unit): the box or the pixel when it spans under
+     * gLodBoxPixels or gLodSplatPixels, and otherwise the coarsest level
+     * straying no more than [pixelError] pixels from the mesh.
+     */
+  int Select(float scale, float pixelError) const
+  {
+    const float size = (2.0f * mRadius * scale);
+    if (size < gLodSplatPixels)
+      return (BoxLevel() + 1);
+    if (size < gLodBoxPixels)
+      return BoxLevel();
+    int level = 0;
+    while (((level + 1) < BoxLevel()) && ((mLevels[level + 1].mError * scale) <= pixelError))
+      ++level;
+    return level;
+  }
+};
+
+
+/*############################################################################*/
+/*########################### Function Prototypes ############################*/
+/*############################################################################*/
+
+  /*
+   * Build the levels of detail of [mesh] into [lod]. Each level simplifies
+   * the loops of the mesh's outline and the chains of its edges to twice the
+   * tolerance of the one before (keeping only the vertices needed to stay
+   * within it), then triangulates what is left of the outline (see
+   * BuildMeshLayout()). The faces are kept as they are once simplifying the
+   * outline leaves a polygon that cannot be triangulated (or when the
+   * outline does not form simple loops).
+   */
+void BuildMeshLod(MyMesh &mesh, MeshLod &lod);
+
+
+#endif
@@ -0,0 +1,199 @@
+/*!
+*****************************************************************************
+\file   MsaaFill.cpp
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the implementation of FillMultisampledTriangle.
+
+  Each sample of a pixel sits at a fixed offset from the pixel's center, so
+  on every scanline the samples with the same offset form a sub-scanline of
+  their own, which the triangle crosses in a single run of pixels. The
+  pixels inside every one of those runs are fully covered; the ones inside
+  only some of them lie along the triangle's edges.
+
+  Sample positions are tested with the same half-open rule as pixel
+  centers, with each edge evaluated from its lower end point, so triangles
+  sharing an edge cover each of its samples exactly once.
+*******************************************************************************/
+#include "MsaaFill.h"
+#include "RasterUtilities.h"
+#include <algorithm>
+#include <climits>
+
+
+/*############################################################################*/
+/*############################# Global Constants #############################*/
+/*############################################################################*/
+
+  /*
+   * The sample offsets from the pixel center (in 1/16ths of a pixel) for
+   * 1, 2, 4 and 8 samples: no two samples share a row or a column, so
+   * near-vertical and near-horizontal edges both get every level of
+   * coverage.
+   */
+static const int gOffsets1x[1][2] = { {  0,  0 } };
+static const int gOffsets2x[2][2] = { {  4,  4 }, { -4, -4 } };
+static const int gOffsets4x[4][2] = { { -2, -6 }, {  6, -2 }, { -6,  2 }, {  2,  6 } };
+static const int gOffsets8x[8][2] = { {  1, -3 }, { -1,  3 }, {  5,  1 }, { -3, -5 },
+                                      { -5,  5 }, { -7, -1 }, {  3,  7 }, {  7, -7 } };
+
+
+/*############################################################################*/
+/*########################## Local Helper Functions ##########################*/
+/*############################################################################*/
+
+  /* Round [v] (well within the range of an int) up to an integer. */
+inline
+int CeilToInt(double v)
+{
+  const int i = static_cast<int>(v);
+  return (i + (static_cast<double>(i) < v));
+}
+
+
+/*############################################################################*/
+/*######################### Function Implementation ##########################*/
+/*############################################################################*/
+
+/*!
+******************************************************************************
+  \fn void FillMultisampledTriangle(Raster &raster, const Point &P,
+                                    const Point &Q, const Point &R,
+                                    const Color &color)
+
+  \brief
+    Fill a triangle with anti-aliased edges.
+
+  \param raster
+    The Raster object that the triangle will be drawn to.
+
+  \param P, Q, R
+    The corners of the triangle, in device coordinates.
+
+  \param color
+    The color to fill the triangle in.
+*******************************************************************************/
+void FillMultisampledTriangle(      Raster &raster,
+                              const Point  &P,
+                              const Point  &Q,
+                              const Point  &R,
+                              const Color  &color)
+{
+  raster.SetColor(color.red, color.grn, color.blu);
+  SampleBuffer *pSamples = raster.GetSamples();
+  if (!pSamples || !pSamples->Samples() || (raster.GetAlpha() != gOpaqueAlpha))
+  {
+    FillTriangle(raster, P, Q, R);
+    return;
+  }
+
+  const int n = pSamples->Samples();
+  const int (*pOffsets)[2] = ((n == 8) ? gOffsets8x :
+                              (n == 4) ? gOffsets4x :
+                              (n == 2) ? gOffsets2x : gOffsets1x);
+  double ox[SampleBuffer::scmMaxSamples];
+  double oy[SampleBuffer::scmMaxSamples];
+  for (int s = 0; s < n; ++s)
+  {
+    ox[s] = (pOffsets[s][0] / 16.0);
+    oy[s] = (pOffsets[s][1] / 16.0);
+  }
+
+    /* Sort the corners from the bottom up. */
+  const Point *pCorners[3] = { &P, &Q, &R };
+  std::sort(pCorners, (pCorners + 3),
+            [] (const Point *pLhs, const Point *pRhs) { return (pLhs->y < pRhs->y); } );
+  const Point &A = *pCorners[0];
+  const Point &B = *pCorners[1];
+  const Point &C = *pCorners[2];
+  if (!(A.y < C.y))
+    return;
+
+  const double ay     = A.y;
+  const double by     = B.y;
+  const double cy     = C.y;
+  const double stepAC = ((static_cast<double>(C.x) - A.x) / (cy - ay));
+  const double stepAB = ((by > ay) ? ((static_cast<double>(B.x) - A.x) / (by - ay)) : 0.0);
+  const double stepBC = ((cy > by) ? ((static_cast<double>(C.x) - B.x) / (cy - by)) : 0.0);
+
+    /* The scanlines any sample of which lies within [A.y, C.y). */
+  int yFirst = INT_MAX;
+  int yLast  = INT_MIN;
+  for (int s = 0; s < n; ++s)
+  {
+    yFirst = std::min(yFirst, CeilToInt(ay - oy[s]));
+    yLast  = std::max(yLast,  CeilToInt(cy - oy[s]));
+  }
+  yFirst = std::max(yFirst, 0);
+  yLast  = std::min(yLast,  raster.Height());
+
+  const int          width    = raster.Width();
+  const int          stride   = raster.Stride();
+  Raster::byte      *pBuffer  = raster.Buffer();
+  const Raster::byte rgb[3]   = { color.red, color.grn, color.blu };
+  int                a[SampleBuffer::scmMaxSamples];
+  int                b[SampleBuffer::scmMaxSamples];
+  for (int y = yFirst; y < yLast; ++y)
+  {
+      /* The run of pixels covering each sample on this scanline. */
+    int innerLo = INT_MIN;
+    int innerHi = INT_MAX;
+    int outerLo = INT_MAX;
+    int outerHi = INT_MIN;
+    for (int s = 0; s < n; ++s)
+    {
+      const double sy = (y + oy[s]);
+      if ((sy < ay) || (cy <= sy))
+      {
+        a[s] = INT_MAX;
+        b[s] = INT_MIN;
+        innerLo = INT_MAX;
+        continue;
+      }
+      const double xAC = (A.x + ((sy - ay) * stepAC));
+      const double xUV = ((sy < by) ? (A.x + ((sy - ay) * stepAB))
+                                    : (B.x + ((sy - by) * stepBC)));
+      a[s] = CeilToInt(std::min(xAC, xUV) - ox[s]);
+      b[s] = CeilToInt(std::max(xAC, xUV) - ox[s]);
+      if (a[s] < b[s])
+      {
+        innerLo = std::max(innerLo, a[s]);
+        innerHi = std::min(innerHi, b[s]);
+        outerLo = std::min(outerLo, a[s]);
+        outerHi = std::max(outerHi, b[s]);
+      }
+      else
+        innerLo = INT_MAX;
+    }
+    if (outerHi <= outerLo)
+      continue;
+
+      /* Pixels with every sample covered take the single-sample path... */
+    if (innerLo < innerHi)
+    {
+      raster.GotoPoint(innerLo, y);
+      raster.WriteSpan(innerHi - innerLo);
+    }
+    else
+      innerLo = innerHi = outerHi;
+
+      /* ...while the ones on either side of them set the samples they cover. */
+    const int ends[2][2] = { { std::max(outerLo, 0), std::min(innerLo, width) },
+                             { std::max(innerHi, 0), std::min(outerHi, width) } };
+    for (int side = 0; side < 2; ++side)
+      for (int x = ends[side][0]; x < ends[side][1]; ++x)
+      {
+        unsigned mask = 0;
+        for (int s = 0; s < n; ++s)
+          if ((a[s] <= x) && (x < b[s]))
+            mask |= (1u << s);
+        pSamples->Cover(x, y, mask, (pBuffer + (y * stride) + (3 * x)), rgb);
+      }
+  }
+}
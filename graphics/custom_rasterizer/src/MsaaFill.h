@@ -0,0 +1,45 @@
+/*!
+*****************************************************************************
+\file   MsaaFill.h
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the prototype of FillMultisampledTriangle, which fills
+  triangles with anti-aliased edges by testing several samples per pixel.
+*******************************************************************************/
+#ifndef MSAAFILL_H
+#define MSAAFILL_H
+
+#include "Affine.h"
+#include "Color.h"
+#include "Raster.h"
+
+
+/*############################################################################*/
+/*########################### Function Prototypes ############################*/
+/*############################################################################*/
+
+  /*
+   * Fill the triangle [P][Q][R] (in device coordinates, already clipped to
+   * the screen) in [color], testing each pixel at the sample positions of
+   * the Raster object's SampleBuffer (see Raster::SetSamples()) rather than
+   * at its center. Pixels with every sample inside the triangle are written
+   * a span at a time, as FillTriangle would; only the pixels along its edges
+   * have their covered samples set in the SampleBuffer, to be blended when
+   * it is resolved. Without a SampleBuffer (or when drawing translucently,
+   * see Raster::SetAlpha()), this is FillTriangle. Either way, [color] is
+   * left as the current foreground color.
+   */
+void FillMultisampledTriangle(      Raster &raster,
+                              const Point  &P,
+                              const Point  &Q,
+                              const Point  &R,
+                              const Color  &color);
+
+
+#endif
@@ -32,15 +32,20 @@
 MyMesh::MyMesh(const std::vector<Point> &rVertices,
                const std::vector<Edge>  &rEdges,
                const std::vector<Face>  &rFaces,
+               const std::vector<int>   &rOutline,
                const Vector             &rDimensions,
                      Point               center)
   : Mesh(),
     mrVertices(rVertices),
     mrEdges(rEdges),
     mrFaces(rFaces),
+    mrOutline(rOutline),
     mrDimensions(rDimensions),
+    mCenter(center),
     mTempVerts(),
-    mCenter(center) { ; }
+    mVertColors(),
+    mpTexture(NULL),
+    mVertUVs() { ; }
 
   /* Default Destructor. */
 MyMesh::~MyMesh(void) { ; }
@@ -60,6 +65,9 @@ int MyMesh::EdgeCount(void) { return mrEdges.size(); }
   /* Get the number of faces in of the mesh. */
 int MyMesh::FaceCount(void) { return mrFaces.size(); }
 
+  /* Get the outline of the faces of the mesh (see MeshOutline()). */
+const std::vector<int> &MyMesh::Outline(void) { return mrOutline; }
+
   /* Access the i_th vertex of the mesh. */
 Point MyMesh::GetVertex(int i) { return mrVertices[i]; }
 
@@ -83,6 +91,77 @@ void MyMesh::Transform(const Affine &transform)
 
 
 
+/*############################################################################*/
+/*############################# Helper Functions #############################*/
+/*############################################################################*/
+
+/*!
+******************************************************************************
+  \fn std::vector<int> MeshOutline(const std::vector<Point> &vertices,
+                                   const std::vector<Mesh::Face> &faces)
+
+  \brief
+    Build the outline of a mesh's faces, so that they can be filled all at
+    once by the non-zero rule (see FillPolygonEdges()). The faces are wound
+    counterclockwise (any with no area are skipped) so that every point
+    inside of them is wound around at least once, and each pair of edges
+    running both ways between the same two vertices (an edge shared by two
+    faces) is dropped, as it adds nothing to the winding of any point.
+
+  \param vertices
+    The vertices of the mesh.
+
+  \param faces
+    The faces of the mesh.
+
+  \return
+    The edges of the outline, as (from, to) pairs of vertex indices.
+*******************************************************************************/
+std::vector<int> MeshOutline(const std::vector<Point>      &vertices,
+                             const std::vector<Mesh::Face> &faces)
+{
+  std::vector<int> edges;
+  for (unsigned int i = 0; i < faces.size(); ++i)
+  {
+    const Mesh::Face &f = faces[i];
+    const Point &P      = vertices[f.index1];
+    const Point &Q      = vertices[f.index2];
+    const Point &R      = vertices[f.index3];
+    const float  area   = (((Q.x - P.x) * (R.y - P.y)) - ((Q.y - P.y) * (R.x - P.x)));
+    if (area == 0.0f)
+      continue;
+    const int corners[3] = { f.index1,
+                             ((0.0f < area) ? f.index2 : f.index3),
+                             ((0.0f < area) ? f.index3 : f.index2) };
+    for (int j = 0; j < 3; ++j)
+    {
+      edges.push_back(corners[j]);
+      edges.push_back(corners[(j + 1) % 3]);
+    }
+  }
+
+  const unsigned int edgeCount = (edges.size() / 2);
+  std::vector<bool>  dropped(edgeCount, false);
+  for (unsigned int e = 0; e < edgeCount; ++e)
+    for (unsigned int o = (e + 1); !dropped[e] && (o < edgeCount); ++o)
+      if (!dropped[o] && (edges[2 * o] == edges[(2 * e) + 1]) && (edges[(2 * o) + 1] == edges[2 * e]))
+      {
+        dropped[e] = true;
+        dropped[o] = true;
+      }
+
+  std::vector<int> outline;
+  for (unsigned int e = 0; e < edgeCount; ++e)
+    if (!dropped[e])
+    {
+      outline.push_back(edges[2 * e]);
+      outline.push_back(edges[(2 * e) + 1]);
+    }
+  return outline;
+}
+
+
+
 /*############################################################################*/
 /*############################################################################*/
 /*######################### Static Mesh Layout Data ##########################*/
@@ -167,6 +246,9 @@ const std::vector<Mesh::Edge> CustomMesh::mEdges(CMesh::mEdges,
 const std::vector<Mesh::Face> CustomMesh::mFaces(CMesh::mFaces,
                                                  (CMesh::mFaces +
                                                   CMesh::mFaceCount));
+  /* A static std::vector<...> of the outline of this mesh's faces. */
+const std::vector<int> CustomMesh::mOutline(MeshOutline(CustomMesh::mVertices,
+                                                        CustomMesh::mFaces));
   /* The dimensions of this mesh's object-space. */
 const Vector CustomMesh::mDimensions(4.0f, 10.0f);
 
@@ -211,6 +293,9 @@ const std::vector<Mesh::Edge> SquareMesh::mEdges(SMesh::mEdges,
 const std::vector<Mesh::Face> SquareMesh::mFaces(SMesh::mFaces,
                                                  (SMesh::mFaces +
                                                   SMesh::mFaceCount));
+  /* A static std::vector<...> of the outline of this mesh's faces. */
+const std::vector<int> SquareMesh::mOutline(MeshOutline(SquareMesh::mVertices,
+                                                        SquareMesh::mFaces));
   /* The dimensions of this mesh's object-space. */
 const Vector SquareMesh::mDimensions(1.0f, 1.0f);
 
@@ -221,12 +306,12 @@ const Vector SquareMesh::mDimensions(1.0f, 1.0f);
 /*############################################################################*/
 
 CustomMesh::CustomMesh(void)
-  : MyMesh(mVertices, mEdges, mFaces, mDimensions)
+  : MyMesh(mVertices, mEdges, mFaces, mOutline, mDimensions)
 {
 }
 
 SquareMesh::SquareMesh(void)
-  : MyMesh(mVertices, mEdges, mFaces, mDimensions)
+  : MyMesh(mVertices, mEdges, mFaces, mOutline, mDimensions)
 {
 }
 
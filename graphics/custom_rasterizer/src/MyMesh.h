@@ -16,6 +16,8 @@
 
 #include "Mesh.h"
 #include "Affine.h"
+#include "Color.h"
+#include "Texture.h"
 #include <vector>
 #include <algorithm>
 
@@ -60,6 +62,8 @@ private:
   const std::vector<Edge>  &mrEdges;
     /* A reference to the std::vector<...> faces of some derived mesh. */
   const std::vector<Face>  &mrFaces;
+    /* A reference to the std::vector<...> outline of some derived mesh. */
+  const std::vector<int>   &mrOutline;
     /* A reference to the dimensions of the object-space of some derived mesh */
   const Vector             &mrDimensions;
 
@@ -74,6 +78,7 @@ public:
   MyMesh(const std::vector<Point> &rVertices,
          const std::vector<Edge>  &rEdges,
          const std::vector<Face>  &rFaces,
+         const std::vector<int>   &rOutline,
          const Vector             &rDimensions,
                Point               center = Point(0.0f, 0.0f));
     /* Default Destructor. */
@@ -90,6 +95,8 @@ public:
   int EdgeCount(void);
     /* Get the number of faces in of the mesh. */
   int FaceCount(void);
+    /* Get the outline of the faces of the mesh (see MeshOutline()). */
+  const std::vector<int> &Outline(void);
 
   /******************************** Accessors *********************************/
     /* Access the i_th vertex of the mesh. */
@@ -118,6 +125,20 @@ private:
 public:
     /* Store the temporary transformed vertices after a call to Transform(). */
   std::vector<Point> mTempVerts;
+    /*
+     * The color of each vertex (empty for a flat shaded mesh). Each face is
+     * shaded by blending the colors of its vertices, tinted by the face color
+     * of the object drawing the mesh.
+     */
+  std::vector<Color> mVertColors;
+    /*
+     * The texture the faces are filled with (NULL for an untextured mesh), and
+     * the texture coordinates (u, v) of each vertex. The texture is tinted by
+     * the face color of the object drawing the mesh, and replaces any vertex
+     * colors above.
+     */
+  const Texture     *mpTexture;
+  std::vector<Point> mVertUVs;
 };
 
 
@@ -186,6 +207,8 @@ private:
   static const std::vector<Edge>  mEdges;
     /* A static std::vector<...> of the faces that define this mesh. */
   static const std::vector<Face>  mFaces;
+    /* A static std::vector<...> of the outline of this mesh's faces. */
+  static const std::vector<int>   mOutline;
     /* The dimensions of this mesh's object-space. */
   static const Vector             mDimensions;
 };
@@ -221,10 +244,27 @@ private:
   static const std::vector<Edge>  mEdges;
     /* A static std::vector<...> of the faces that define this mesh. */
   static const std::vector<Face>  mFaces;
+    /* A static std::vector<...> of the outline of this mesh's faces. */
+  static const std::vector<int>   mOutline;
     /* The dimensions of this mesh's object-space. */
   static const Vector             mDimensions;
 };
 
 
+
+/*############################################################################*/
+/*########################### Function Prototypes ############################*/
+/*############################################################################*/
+
+  /*
+   * Build the outline of [faces] (of [vertices]): the edges of every face,
+   * as (from, to) index pairs, with the faces all wound the same way and the
+   * edges shared by two faces dropped. Filled by the non-zero rule (see
+   * FillPolygonEdges()), it covers the pixels the faces cover, each once.
+   */
+std::vector<int> MeshOutline(const std::vector<Point>      &vertices,
+                             const std::vector<Mesh::Face> &faces);
+
+
 #endif
 
@@ -0,0 +1,540 @@
+/*!
+*****************************************************************************
+\file   Path.cpp
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the implementation of the Path class and of
+  FlattenPath, DrawPath and FillPath.
+
+  Curves are flattened after being transformed to device coordinates, so
+  the tolerance is in pixels and the number of lines a curve is cut into
+  follows its size on screen. A curve is cut into n equal steps in t, with
+  n the fewest that keep the lines within the tolerance of the curve (the
+  chord of a step of t strays at most h^2 / 8 times the largest second
+  derivative, which for a Bezier curve is bounded by its control points).
+  The points along it are then stepped by forward differencing in 32.32
+  fixed point, so each one costs a few integer additions.
+*******************************************************************************/
+#include "Path.h"
+#include "FixedPoint.h"
+#include "RasterUtilities.h"
+#include "ScreenClip.h"
+#include <algorithm>
+#include <cmath>
+
+
+/*############################################################################*/
+/*############################# Global Constants #############################*/
+/*############################################################################*/
+
+  /* The most lines a single curve is cut into. */
+static const int    gMaxSegments  = 256;
+  /* The smallest tolerance (in pixels) curves are flattened to. */
+static const float  gMinTolerance = 1.0f / 64.0f;
+  /*
+   * Curves reaching further than this (in pixels) from their start are
+   * stepped in floating point, as their differences might not fit in fixed
+   * point.
+   */
+static const double gMaxReach     = 16777216.0;
+
+
+/*############################################################################*/
+/*########################## Local Helper Functions ##########################*/
+/*############################################################################*/
+
+  /* The paths being drawn or filled, flattened. */
+static FlatPath sFlatPath;
+
+  /*
+   * Whether the [count] points at [pPoints] all lie past the same side of
+   * [bounds] (by more than a pixel), so that neither they nor anything
+   * within their convex hull reaches any of its pixels.
+   */
+static bool Outside(const Point *pPoints, int count, const DirtyRect &bounds)
+{
+  float xMin = pPoints[0].x, xMax = pPoints[0].x;
+  float yMin = pPoints[0].y, yMax = pPoints[0].y;
+  for (int i = 1; i < count; ++i)
+  {
+    xMin = std::min(xMin, pPoints[i].x);
+    xMax = std::max(xMax, pPoints[i].x);
+    yMin = std::min(yMin, pPoints[i].y);
+    yMax = std::max(yMax, pPoints[i].y);
+  }
+  return ((xMax < static_cast<float>(bounds.mX0 - 1)) ||
+          (yMax < static_cast<float>(bounds.mY0 - 1)) ||
+          (static_cast<float>(bounds.mX1) < xMin)      ||
+          (static_cast<float>(bounds.mY1) < yMin));
+}
+
+  /*
+   * The fewest equal steps a curve must be cut into so that its chords
+   * stray at most [tolerance] from it, where [bend] is half the largest its
+   * second derivative gets (the chords then stray at most bend / (4 n^2)).
+   */
+inline
+int SegmentCount(double bend, float tolerance)
+{
+  const double n = std::ceil(std::sqrt(bend / (4.0 * tolerance)));
+  return ((n < 1.0) ? 1 : ((n > gMaxSegments) ? gMaxSegments : static_cast<int>(n)));
+}
+
+  /*
+   * Append to [points] the points of the curve P0 + (c * t) + (b * t^2) +
+   * (a * t^3) (given by the x and y of a, b and c) after P0 in [count] equal
+   * steps of t, the last one being exactly [end].
+   */
+static void StepCurve(      std::vector<Point> &points,
+                      const Point              &P0,
+                      const Point              &end,
+                            double ax, double ay,
+                            double bx, double by,
+                            double cx, double cy,
+                            int    count,
+                            double reach)
+{
+  const double h  = (1.0 / count);
+  const double h2 = (h * h);
+  const double h3 = (h2 * h);
+
+  if (reach <= gMaxReach)
+  {
+      /* The curve (less P0) and its first three forward differences. */
+    Fixed fx    = 0;
+    Fixed fy    = 0;
+    Fixed dfx   = ToFixed((ax * h3) + (bx * h2) + (cx * h));
+    Fixed dfy   = ToFixed((ay * h3) + (by * h2) + (cy * h));
+    Fixed ddfx  = ToFixed((6.0 * ax * h3) + (2.0 * bx * h2));
+    Fixed ddfy  = ToFixed((6.0 * ay * h3) + (2.0 * by * h2));
+    Fixed dddfx = ToFixed(6.0 * ax * h3);
+    Fixed dddfy = ToFixed(6.0 * ay * h3);
+    for (int i = 1; i < count; ++i)
+    {
+      fx   += dfx;
+      fy   += dfy;
+      dfx  += ddfx;
+      dfy  += ddfy;
+      ddfx += dddfx;
+      ddfy += dddfy;
+      points.push_back(Point(P0.x + static_cast<float>(static_cast<double>(fx) / gFixedOne),
+                             P0.y + static_cast<float>(static_cast<double>(fy) / gFixedOne)));
+    }
+  }
+  else
+  {
+    for (int i = 1; i < count; ++i)
+    {
+      const double t = (i * h);
+      points.push_back(Point(P0.x + static_cast<float>((((ax * t) + bx) * t + cx) * t),
+                             P0.y + static_cast<float>((((ay * t) + by) * t + cy) * t)));
+    }
+  }
+  points.push_back(end);
+}
+
+  /* Append the quadratic curve from [P0] through [P1] to [P2] to [points] (after P0). */
+static void FlattenQuad(      std::vector<Point> &points,
+                        const Point              &P0,
+                        const Point              &P1,
+                        const Point              &P2,
+                              float               tolerance)
+{
+    /* P0 + (2 * (P1 - P0) * t) + ((P0 - 2 P1 + P2) * t^2); its second derivative is constant. */
+  const double bx    = (static_cast<double>(P0.x) - (2.0 * P1.x) + P2.x);
+  const double by    = (static_cast<double>(P0.y) - (2.0 * P1.y) + P2.y);
+  const double cx    = (2.0 * (static_cast<double>(P1.x) - P0.x));
+  const double cy    = (2.0 * (static_cast<double>(P1.y) - P0.y));
+  const double reach = std::max(std::max(std::fabs(cx), std::fabs(cy)),
+                                std::max(std::fabs(static_cast<double>(P2.x) - P0.x),
+                                         std::fabs(static_cast<double>(P2.y) - P0.y)));
+  const int    count = SegmentCount(std::sqrt((bx * bx) + (by * by)), tolerance);
+
+  StepCurve(points, P0, P2, 0.0, 0.0, bx, by, cx, cy, count, reach);
+}
+
+  /* Append the cubic curve from [P0] through [P1] and [P2] to [P3] to [points] (after P0). */
+static void FlattenCubic(      std::vector<Point> &points,
+                         const Point              &P0,
+                         const Point              &P1,
+                         const Point              &P2,
+                         const Point              &P3,
+                               float               tolerance)
+{
+    /*
+     * The second derivative runs linearly between 6 (P0 - 2 P1 + P2) and
+     * 6 (P1 - 2 P2 + P3), so it is largest at one of the ends.
+     */
+  const double d0x   = (static_cast<double>(P0.x) - (2.0 * P1.x) + P2.x);
+  const double d0y   = (static_cast<double>(P0.y) - (2.0 * P1.y) + P2.y);
+  const double d1x   = (static_cast<double>(P1.x) - (2.0 * P2.x) + P3.x);
+  const double d1y   = (static_cast<double>(P1.y) - (2.0 * P2.y) + P3.y);
+  const double bend  = (3.0 * std::sqrt(std::max((d0x * d0x) + (d0y * d0y),
+                                                 (d1x * d1x) + (d1y * d1y))));
+  const double reach = std::max(std::max(std::max(std::fabs(static_cast<double>(P1.x) - P0.x),
+                                                  std::fabs(static_cast<double>(P1.y) - P0.y)),
+                                         std::max(std::fabs(static_cast<double>(P2.x) - P0.x),
+                                                  std::fabs(static_cast<double>(P2.y) - P0.y))),
+                                std::max(std::fabs(static_cast<double>(P3.x) - P0.x),
+                                         std::fabs(static_cast<double>(P3.y) - P0.y)));
+  const int    count = SegmentCount(bend, tolerance);
+
+    /* P0 + (c * t) + (b * t^2) + (a * t^3) */
+  StepCurve(points, P0, P3,
+            (static_cast<double>(P3.x) - P0.x + (3.0 * (static_cast<double>(P1.x) - P2.x))),
+            (static_cast<double>(P3.y) - P0.y + (3.0 * (static_cast<double>(P1.y) - P2.y))),
+            (3.0 * d0x), (3.0 * d0y),
+            (3.0 * (static_cast<double>(P1.x) - P0.x)),
+            (3.0 * (static_cast<double>(P1.y) - P0.y)),
+            count, reach);
+}
+
+  /*
+   * End the contour of [flat] starting at point [first], dropping it when it
+   * has fewer than two points.
+   */
+static void EndContour(FlatPath &flat, int first, bool closed)
+{
+  if ((static_cast<int>(flat.mPoints.size()) - first) < 2)
+  {
+    flat.mPoints.resize(first);
+    return;
+  }
+  flat.mContourEnds.push_back(static_cast<int>(flat.mPoints.size()));
+  flat.mClosed.push_back(closed);
+}
+
+
+/*############################################################################*/
+/*######################### Function Implementation ##########################*/
+/*############################################################################*/
+
+/*!
+******************************************************************************
+  \fn Path::Path(void)
+
+  \brief
+    Default Constructor. Initializes to an empty path.
+*******************************************************************************/
+Path::Path(void)
+{ ; }
+
+/*!
+******************************************************************************
+  \fn const std::vector<Path::Verb> &Path::Verbs(void) const
+
+  \brief
+    The pieces of the path, in order.
+
+  \return
+    The pieces of the path.
+*******************************************************************************/
+const std::vector<Path::Verb> &Path::Verbs(void) const
+{ return mVerbs; }
+
+/*!
+******************************************************************************
+  \fn const std::vector<Point> &Path::Points(void) const
+
+  \brief
+    The points of the pieces of the path, in order: one for a MoveTo or a
+    LineTo, two for a QuadTo, three for a CubicTo and none for a Close.
+
+  \return
+    The points of the path.
+*******************************************************************************/
+const std::vector<Point> &Path::Points(void) const
+{ return mPoints; }
+
+/*!
+******************************************************************************
+  \fn void Path::Clear(void)
+
+  \brief
+    Empty the path, keeping its storage so that it can be rebuilt without
+    allocating.
+*******************************************************************************/
+void Path::Clear(void)
+{
+  mVerbs.clear();
+  mPoints.clear();
+}
+
+/*!
+******************************************************************************
+  \fn void Path::MoveTo(const Point &P)
+
+  \brief
+    Start a new contour at [P].
+
+  \param P
+    The start of the contour.
+*******************************************************************************/
+void Path::MoveTo(const Point &P)
+{
+  mVerbs.push_back(eMoveTo);
+  mPoints.push_back(P);
+}
+
+/*!
+******************************************************************************
+  \fn void Path::LineTo(const Point &P)
+
+  \brief
+    Add a line from the end of the last piece to [P].
+
+  \param P
+    The end of the line.
+*******************************************************************************/
+void Path::LineTo(const Point &P)
+{
+  mVerbs.push_back(eLineTo);
+  mPoints.push_back(P);
+}
+
+/*!
+******************************************************************************
+  \fn void Path::QuadTo(const Point &C, const Point &P)
+
+  \brief
+    Add a quadratic Bezier curve from the end of the last piece, pulled
+    towards [C], to [P].
+
+  \param C
+    The control point of the curve.
+
+  \param P
+    The end of the curve.
+*******************************************************************************/
+void Path::QuadTo(const Point &C, const Point &P)
+{
+  mVerbs.push_back(eQuadTo);
+  mPoints.push_back(C);
+  mPoints.push_back(P);
+}
+
+/*!
+******************************************************************************
+  \fn void Path::CubicTo(const Point &C1, const Point &C2, const Point &P)
+
+  \brief
+    Add a cubic Bezier curve from the end of the last piece, pulled towards
+    [C1] and then [C2], to [P].
+
+  \param C1
+    The first control point of the curve.
+
+  \param C2
+    The second control point of the curve.
+
+  \param P
+    The end of the curve.
+*******************************************************************************/
+void Path::CubicTo(const Point &C1, const Point &C2, const Point &P)
+{
+  mVerbs.push_back(eCubicTo);
+  mPoints.push_back(C1);
+  mPoints.push_back(C2);
+  mPoints.push_back(P);
+}
+
+/*!
+******************************************************************************
+  \fn void Path::Close(void)
+
+  \brief
+    Close the current contour with a line back to its start. Pieces added
+    after it (without a MoveTo) start a new contour there.
+*******************************************************************************/
+void Path::Close(void)
+{
+  mVerbs.push_back(eClose);
+}
+
+/*!
+******************************************************************************
+  \fn void FlattenPath(const Path &path, const Affine &worldToDev,
+                       float tolerance, FlatPath &flat,
+                       const DirtyRect *pBounds)
+
+  \brief
+    Transform [path] to device coordinates and append its contours to
+    [flat] as polylines, cutting each curve into as few lines as keep it
+    within [tolerance] pixels of the true curve. Contours of fewer than two
+    points are dropped.
+
+  \param path
+    The path to flatten.
+
+  \param worldToDev
+    Transformation from world to device coordinates.
+
+  \param tolerance
+    How far (in pixels) the lines may stray from the curves.
+
+  \param flat
+    The flattened paths to append to.
+
+  \param pBounds
+    The pixels that will be drawn to (NULL when unknown). Curves whose
+    control points all lie past the same side of it are flattened to a
+    single line, as neither they nor the line reach it.
+*******************************************************************************/
+void FlattenPath(const Path      &path,
+                 const Affine    &worldToDev,
+                       float      tolerance,
+                       FlatPath  &flat,
+                 const DirtyRect *pBounds)
+{
+  const std::vector<Path::Verb> &verbs  = path.Verbs();
+  const std::vector<Point>      &points = path.Points();
+
+  tolerance = std::max(tolerance, gMinTolerance);
+
+  Point        control[4];
+  Point        start = worldToDev * Point(0.0f, 0.0f);
+  bool         open  = false;
+  int          first = 0;
+  unsigned int p     = 0;
+  for (unsigned int v = 0; v < verbs.size(); ++v)
+  {
+    const Path::Verb verb = verbs[v];
+    if ((verb == Path::eMoveTo) || (verb == Path::eClose))
+    {
+      if (open)
+        EndContour(flat, first, (verb == Path::eClose));
+      open = false;
+      if (verb == Path::eMoveTo)
+        start = worldToDev * points[p++];
+      continue;
+    }
+      /* The first piece after a MoveTo or a Close starts the contour. */
+    if (!open)
+    {
+      first = static_cast<int>(flat.mPoints.size());
+      flat.mPoints.push_back(start);
+      open  = true;
+    }
+    control[0] = flat.mPoints.back();
+    if (verb == Path::eLineTo)
+    {
+      flat.mPoints.push_back(worldToDev * points[p++]);
+      continue;
+    }
+    const int count = ((verb == Path::eQuadTo) ? 3 : 4);
+    for (int i = 1; i < count; ++i)
+      control[i] = worldToDev * points[p++];
+    if (pBounds && Outside(control, count, *pBounds))
+      flat.mPoints.push_back(control[count - 1]);
+    else if (verb == Path::eQuadTo)
+      FlattenQuad(flat.mPoints, control[0], control[1], control[2], tolerance);
+    else
+      FlattenCubic(flat.mPoints, control[0], control[1], control[2], control[3], tolerance);
+  }
+  if (open)
+    EndContour(flat, first, false);
+}
+
+/*!
+******************************************************************************
+  \fn void DrawPath(Raster &raster, const Path &path,
+                    const Affine &worldToDev, float tolerance)
+
+  \brief
+    Draw the contours of [path] with DrawLine in the current foreground
+    color, each line clipped to the screen.
+
+  \param raster
+    The raster to draw to.
+
+  \param path
+    The path to draw.
+
+  \param worldToDev
+    Transformation from world to device coordinates.
+
+  \param tolerance
+    How far (in pixels) the lines drawn may stray from the curves.
+*******************************************************************************/
+void DrawPath(      Raster &raster,
+              const Path   &path,
+              const Affine &worldToDev,
+                    float   tolerance)
+{
+  Clip &screenClip = ScreenClip(raster.Width(), raster.Height());
+
+  const DirtyRect screen(0, 0, raster.Width(), raster.Height());
+    /* The pixel centers of the screen. */
+  const float     wMax = static_cast<float>(raster.Width()  - 1);
+  const float     hMax = static_cast<float>(raster.Height() - 1);
+
+  sFlatPath.Clear();
+  FlattenPath(path, worldToDev, tolerance, sFlatPath, &screen);
+
+  int first = 0;
+  for (unsigned int c = 0; c < sFlatPath.mContourEnds.size(); ++c)
+  {
+    const int end = sFlatPath.mContourEnds[c];
+      /* Closed contours end with a line back to their first point. */
+    const int last = (sFlatPath.mClosed[c] ? end : (end - 1));
+    for (int i = first; i < last; ++i)
+    {
+      Point P = sFlatPath.mPoints[i];
+      Point Q = sFlatPath.mPoints[((i + 1) < end) ? (i + 1) : first];
+      if (!(InRect(P, 0.0f, 0.0f, wMax, hMax) &&
+            InRect(Q, 0.0f, 0.0f, wMax, hMax)) &&
+          !screenClip(P, Q))
+        continue;
+      DrawLine(raster, P, Q);
+    }
+    first = end;
+  }
+}
+
+/*!
+******************************************************************************
+  \fn void FillPath(Raster &raster, const Path &path,
+                    const Affine &worldToDev, float tolerance,
+                    PolygonFillRule rule)
+
+  \brief
+    Fill the contours of [path] (each closed back to its start) in the
+    current foreground color as one polygon, a scanline at a time, so that
+    concave contours, holes and overlaps are filled by [rule].
+
+  \param raster
+    The raster to draw to.
+
+  \param path
+    The path to fill.
+
+  \param worldToDev
+    Transformation from world to device coordinates.
+
+  \param tolerance
+    How far (in pixels) the edges filled may stray from the curves.
+
+  \param rule
+    Which points the contours wind around are filled.
+*******************************************************************************/
+void FillPath(      Raster          &raster,
+              const Path            &path,
+              const Affine          &worldToDev,
+                    float            tolerance,
+                    PolygonFillRule  rule)
+{
+  const DirtyRect screen(0, 0, raster.Width(), raster.Height());
+
+  sFlatPath.Clear();
+  FlattenPath(path, worldToDev, tolerance, sFlatPath, &screen);
+  if (sFlatPath.mContourEnds.empty())
+    return;
+  FillPolygon(raster, &sFlatPath.mPoints[0], &sFlatPath.mContourEnds[0],
+              static_cast<int>(sFlatPath.mContourEnds.size()), rule, screen);
+}
@@ -0,0 +1,165 @@
+/*!
+*****************************************************************************
+\file   Path.h
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the definitions of the Path class, which holds shapes
+  made of lines and quadratic/cubic Bezier curves, and of the FlatPath
+  struct that paths are flattened into, along with the prototypes of the
+  functions that flatten, draw and fill them.
+*******************************************************************************/
+#ifndef PATH_H
+#define PATH_H
+
+#include "Affine.h"
+#include "DamageTracker.h"
+#include "PolygonFill.h"
+#include "Raster.h"
+#include <vector>
+
+
+/*############################################################################*/
+/*############################# Global Constants #############################*/
+/*############################################################################*/
+
+  /* How far (in pixels) flattened curves may stray from the true ones by default. */
+static const float gPathTolerance = 0.25f;
+
+
+/*!
+******************************************************************************
+  \class Path
+
+  \brief
+    A shape (in world coordinates) made of contours, each starting with a
+    MoveTo() and followed by lines and quadratic/cubic Bezier curves, each
+    piece starting where the last one ended. Contours may be closed back
+    to their start.
+*******************************************************************************/
+class Path
+{
+/*############################################################################*/
+/*############################## Public Defines ##############################*/
+/*############################################################################*/
+public:
+    /* The pieces a path is made of. */
+  enum Verb
+  {
+    eMoveTo,   /* Start a new contour at a point.                    */
+    eLineTo,   /* A line to a point.                                 */
+    eQuadTo,   /* A quadratic curve: a control point, then its end.  */
+    eCubicTo,  /* A cubic curve: two control points, then its end.   */
+    eClose     /* Close the contour back to its start (no point).    */
+  };
+
+
+/*############################################################################*/
+/*############################## Public Methods ##############################*/
+/*############################################################################*/
+public:
+
+  /******************************* Constructors *******************************/
+    /* Default Constructor. Initializes to an empty path. */
+  Path(void);
+
+  /********************************* Getters **********************************/
+    /* The pieces of the path, in order. */
+  const std::vector<Verb>  &Verbs(void) const;
+    /* The points of the pieces, in order. */
+  const std::vector<Point> &Points(void) const;
+
+  /********************************* Mutators *********************************/
+    /* Empty the path (keeping its storage). */
+  void Clear(void);
+    /* Start a new contour at [P]. */
+  void MoveTo(const Point &P);
+    /* Add a line to [P]. */
+  void LineTo(const Point &P);
+    /* Add a quadratic curve through control point [C] to [P]. */
+  void QuadTo(const Point &C, const Point &P);
+    /* Add a cubic curve through control points [C1] and [C2] to [P]. */
+  void CubicTo(const Point &C1, const Point &C2, const Point &P);
+    /* Close the current contour back to its start. */
+  void Close(void);
+
+
+/*############################################################################*/
+/*############################# Private Members ##############################*/
+/*############################################################################*/
+private:
+  std::vector<Verb>  mVerbs;
+  std::vector<Point> mPoints;
+};
+
+/*!
+******************************************************************************
+  \struct FlatPath
+
+  \brief
+    Paths flattened into polylines (in device coordinates): the points of
+    every contour, one after the other, with where each contour ends and
+    whether it is closed. Flattening appends, so many paths can be batched
+    into one FlatPath, and clearing keeps the storage, so reusing one does
+    not allocate.
+*******************************************************************************/
+struct FlatPath
+{
+    /* The points of every contour. */
+  std::vector<Point> mPoints;
+    /* One past the index of the last point of each contour. */
+  std::vector<int>   mContourEnds;
+    /* Whether each contour is closed. */
+  std::vector<bool>  mClosed;
+
+    /* Empty the flattened paths (keeping their storage). */
+  void Clear(void)
+  {
+    mPoints.clear();
+    mContourEnds.clear();
+    mClosed.clear();
+  }
+};
+
+
+/*############################################################################*/
+/*########################### Function Prototypes ############################*/
+/*############################################################################*/
+
+  /*
+   * Transform [path] by [worldToDev] and append it to [flat], turning each
+   * curve into as few lines as keep it within [tolerance] pixels of the
+   * true curve (so curves small on screen cost a line or two). Curves lying
+   * wholly outside of [*pBounds] (when given) are cut into a single line.
+   */
+void FlattenPath(const Path      &path,
+                 const Affine    &worldToDev,
+                       float      tolerance,
+                       FlatPath  &flat,
+                 const DirtyRect *pBounds = NULL);
+  /*
+   * Draw the contours of [path] (transformed by [worldToDev]) with DrawLine
+   * in the current foreground color, clipped to the screen.
+   */
+void DrawPath(      Raster &raster,
+              const Path   &path,
+              const Affine &worldToDev,
+                    float   tolerance = gPathTolerance);
+  /*
+   * Fill the contours of [path] (transformed by [worldToDev], each closed
+   * back to its start) in the current foreground color by [rule], as one
+   * polygon (see FillPolygon()), clipped to the screen.
+   */
+void FillPath(      Raster          &raster,
+              const Path            &path,
+              const Affine          &worldToDev,
+                    float            tolerance = gPathTolerance,
+                    PolygonFillRule  rule      = eNonZero);
+
+
+#endif
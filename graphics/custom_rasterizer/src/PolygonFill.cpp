@@ -0,0 +1,257 @@
+/*!
+*****************************************************************************
+\file   PolygonFill.cpp
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the implementation of FillPolygon and
+  FillPolygonEdges.
+
+  The polygon's edges are gathered into an edge table, sorted by the first
+  scanline each one crosses (edges crossing none, such as horizontal ones,
+  are dropped). The scanlines are then walked in order, keeping the edges
+  crossing the current one in an active edge table sorted by where they
+  cross it: the table gains the edges starting on each scanline, loses the
+  ones that ended, and is re-sorted by insertion (edges only swap places
+  where they cross, so it stays nearly sorted). Walking the active edges in
+  order and summing their windings gives the runs of each scanline lying
+  inside the polygon by the fill rule, each written as one span. As with
+  FillTriangle, the pixel centers on scanlines [ceil(top), ceil(bottom))
+  and in [ceil(left), ceil(right)) of each run are filled.
+*******************************************************************************/
+#include "PolygonFill.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+
+/*############################################################################*/
+/*########################## Local Helper Functions ##########################*/
+/*############################################################################*/
+
+  /* An edge of the polygon, from the first scanline it crosses to its last. */
+struct PolyEdge
+{
+    /* Where the edge crosses the current scanline, and how far it moves per scanline. */
+  double mX;
+  double mStep;
+    /* The scanlines [mY0, mY1) the edge crosses. */
+  int    mY0;
+  int    mY1;
+    /* 1 for edges running down the screen, -1 for those running up it. */
+  int    mWinding;
+};
+
+  /* The edge table, sorted by first scanline once gathered. */
+static std::vector<PolyEdge> sEdges;
+  /* The active edge table: the edges crossing the current scanline. */
+static std::vector<PolyEdge> sActive;
+
+  /* Add the edge from [P] to [Q] to the edge table (the scanlines of it in [clipRect]). */
+static void AddEdge(const Point &P, const Point &Q, const DirtyRect &clipRect)
+{
+  const bool   down = (P.y < Q.y);
+  const Point &U    = (down ? P : Q);
+  const Point &V    = (down ? Q : P);
+    /* Clamped before converting, so that far off edges cannot overflow. */
+  const double y0   = std::max(std::ceil(static_cast<double>(U.y)),
+                               static_cast<double>(clipRect.mY0));
+  const double y1   = std::min(std::ceil(static_cast<double>(V.y)),
+                               static_cast<double>(clipRect.mY1));
+  if (!(y0 < y1))
+    return;
+
+  PolyEdge edge;
+  edge.mStep    = ((static_cast<double>(V.x) - U.x) / (static_cast<double>(V.y) - U.y));
+  edge.mX       = (U.x + (edge.mStep * (y0 - static_cast<double>(U.y))));
+  edge.mY0      = static_cast<int>(y0);
+  edge.mY1      = static_cast<int>(y1);
+  edge.mWinding = (down ? 1 : -1);
+  sEdges.push_back(edge);
+}
+
+  /* Fill the polygon made of the edges in the edge table by [rule], then empty it. */
+static void FillEdges(Raster &raster, PolygonFillRule rule, const DirtyRect &clipRect)
+{
+  if (sEdges.empty())
+    return;
+
+  std::sort(sEdges.begin(), sEdges.end(),
+            [] (const PolyEdge &lhs, const PolyEdge &rhs) { return (lhs.mY0 < rhs.mY0); } );
+
+  const double xMin = static_cast<double>(clipRect.mX0);
+  const double xMax = static_cast<double>(clipRect.mX1);
+  std::size_t  next = 0;
+  int          y    = sEdges[0].mY0;
+  sActive.clear();
+  while ((next < sEdges.size()) || !sActive.empty())
+  {
+      /* Skip the scanlines between the polygon's pieces. */
+    if (sActive.empty())
+      y = sEdges[next].mY0;
+    for (/* next = next */; (next < sEdges.size()) && (sEdges[next].mY0 == y); ++next)
+      sActive.push_back(sEdges[next]);
+    for (std::size_t i = 1; i < sActive.size(); ++i)
+    {
+      const PolyEdge edge = sActive[i];
+      std::size_t    j    = i;
+      for (/* j = i */; (0 < j) && (edge.mX < sActive[j - 1].mX); --j)
+        sActive[j] = sActive[j - 1];
+      sActive[j] = edge;
+    }
+
+      /* Write the runs inside the polygon, merging those that touch. */
+    int    winding = 0;
+    bool   inside  = false;
+    double left    = 0.0;
+      /* The run being merged (empty, at the left of the clip rectangle). */
+    int    x0      = clipRect.mX0;
+    int    x1      = clipRect.mX0;
+    for (std::size_t i = 0; i < sActive.size(); ++i)
+    {
+      winding += sActive[i].mWinding;
+      const bool now = ((rule == eNonZero) ? (winding != 0) : ((winding & 1) != 0));
+      if (now == inside)
+        continue;
+      inside = now;
+      if (inside)
+      {
+        left = sActive[i].mX;
+        continue;
+      }
+      const double l = std::max(std::ceil(left),            xMin);
+      const double r = std::min(std::ceil(sActive[i].mX),   xMax);
+      if (!(l < r))
+        continue;
+      if (static_cast<int>(l) <= x1)
+      {
+        x1 = std::max(x1, static_cast<int>(r));
+        continue;
+      }
+      if (x0 < x1)
+      {
+        raster.GotoPoint(x0, y);
+        raster.WriteSpan(x1 - x0);
+      }
+      x0 = static_cast<int>(l);
+      x1 = static_cast<int>(r);
+    }
+    if (x0 < x1)
+    {
+      raster.GotoPoint(x0, y);
+      raster.WriteSpan(x1 - x0);
+    }
+
+      /* Move on to the next scanline, dropping the edges that end before it. */
+    ++y;
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < sActive.size(); ++i)
+      if (y < sActive[i].mY1)
+      {
+        sActive[kept]     = sActive[i];
+        sActive[kept].mX += sActive[kept].mStep;
+        ++kept;
+      }
+    sActive.resize(kept);
+  }
+  sEdges.clear();
+}
+
+
+/*############################################################################*/
+/*######################### Function Implementation ##########################*/
+/*############################################################################*/
+
+/*!
+******************************************************************************
+  \fn void FillPolygon(Raster &raster, const Point *pPoints,
+                       const int *pContourEnds, int contourCount,
+                       PolygonFillRule rule, const DirtyRect &clipRect)
+
+  \brief
+    Fill a polygon made of one or more closed contours in a single pass,
+    one span per run of each scanline inside it.
+
+  \param raster
+    The Raster object that the polygon will be drawn to.
+
+  \param pPoints
+    The points of every contour, one contour after the other, in device
+    coordinates.
+
+  \param pContourEnds
+    One past the index of the last point of each contour.
+
+  \param contourCount
+    The number of contours.
+
+  \param rule
+    Which points the contours wind around are inside the polygon.
+
+  \param clipRect
+    The pixels that may be drawn to.
+*******************************************************************************/
+void FillPolygon(      Raster          &raster,
+                 const Point           *pPoints,
+                 const int             *pContourEnds,
+                       int              contourCount,
+                       PolygonFillRule  rule,
+                 const DirtyRect       &clipRect)
+{
+  sEdges.clear();
+  int first = 0;
+  for (int c = 0; c < contourCount; ++c)
+  {
+    const int end = pContourEnds[c];
+    for (int i = first; i < end; ++i)
+      AddEdge(pPoints[i], pPoints[((i + 1) < end) ? (i + 1) : first], clipRect);
+    first = end;
+  }
+  FillEdges(raster, rule, clipRect);
+}
+
+/*!
+******************************************************************************
+  \fn void FillPolygonEdges(Raster &raster, const Point *pVerts,
+                            const int *pEdges, int edgeCount,
+                            PolygonFillRule rule, const DirtyRect &clipRect)
+
+  \brief
+    Fill a polygon given as a set of directed edges in a single pass, one
+    span per run of each scanline inside it.
+
+  \param raster
+    The Raster object that the polygon will be drawn to.
+
+  \param pVerts
+    The vertices the edges run between, in device coordinates.
+
+  \param pEdges
+    The edges, as pairs of indices into [pVerts] (from, to).
+
+  \param edgeCount
+    The number of edges.
+
+  \param rule
+    Which points the edges wind around are inside the polygon.
+
+  \param clipRect
+    The pixels that may be drawn to.
+*******************************************************************************/
+void FillPolygonEdges(      Raster          &raster,
+                      const Point           *pVerts,
+                      const int             *pEdges,
+                            int              edgeCount,
+                            PolygonFillRule  rule,
+                      const DirtyRect       &clipRect)
+{
+  sEdges.clear();
+  for (int e = 0; e < edgeCount; ++e, pEdges += 2)
+    AddEdge(pVerts[pEdges[0]], pVerts[pEdges[1]], clipRect);
+  FillEdges(raster, rule, clipRect);
+}
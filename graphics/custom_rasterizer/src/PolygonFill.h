@@ -0,0 +1,66 @@
+/*!
+*****************************************************************************
+\file   PolygonFill.h
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the prototypes of the functions that fill arbitrary
+  (concave, self-intersecting or holed) polygons a scanline at a time.
+*******************************************************************************/
+#ifndef POLYGONFILL_H
+#define POLYGONFILL_H
+
+#include "Affine.h"
+#include "DamageTracker.h"
+#include "Raster.h"
+
+
+/*############################################################################*/
+/*############################# Global Constants #############################*/
+/*############################################################################*/
+
+  /* Which points a polygon's edges wind around are inside of it. */
+enum PolygonFillRule
+{
+  eEvenOdd,  /* Those the edges wind around an odd number of times.  */
+  eNonZero   /* Those the edges wind around any number of times.     */
+};
+
+
+/*############################################################################*/
+/*########################### Function Prototypes ############################*/
+/*############################################################################*/
+
+  /*
+   * Fill the polygon made of the [contourCount] closed contours of the
+   * points at [pPoints] (in device coordinates), contour c ending just
+   * before point [pContourEnds][c], in the current foreground color by
+   * [rule]. The pixels filled are those whose centers lie inside (with the
+   * same rule on the edges as FillTriangle), written one span per run of
+   * each scanline. Only the pixels in [clipRect] are written.
+   */
+void FillPolygon(      Raster          &raster,
+                 const Point           *pPoints,
+                 const int             *pContourEnds,
+                       int              contourCount,
+                       PolygonFillRule  rule,
+                 const DirtyRect       &clipRect);
+  /*
+   * Fill the polygon whose edges are the [edgeCount] directed edges at
+   * [pEdges] (pairs of indices into [pVerts], in device coordinates), as
+   * FillPolygon() does. The edges need not be chained in order.
+   */
+void FillPolygonEdges(      Raster          &raster,
+                      const Point           *pVerts,
+                      const int             *pEdges,
+                            int              edgeCount,
+                            PolygonFillRule  rule,
+                      const DirtyRect       &clipRect);
+
+
+#endif
@@ -0,0 +1,371 @@
+/*!
+*****************************************************************************
+\file   QuadFill.cpp
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the implementation of FillQuad and FillOutlinedQuad.
+
+  Pixel centers lie on integer coordinates, and FillTriangle fills the
+  pixels whose centers lie in [left, right) on the scanlines in
+  [bottom, top) of a triangle (i.e. from the ceiling of each bound). Since
+  geometry is first clipped to the pixel centers of the screen,
+  [0, width - 1] x [0, height - 1], every bound is clamped to that range
+  before being rounded, so the quads cover exactly the pixels their two
+  clipped triangles would. (Clipping moves the triangles' corners onto the
+  screen's edge only up to rounding, which may leave the outermost pixel
+  centers just outside of them; clamping always keeps them in.)
+
+  A parallelogram is the overlap of two slabs, each one bounded by a pair of
+  parallel sides. Along a scanline a slab covers the x values between where
+  its two sides cross it, and those move by the same constant amount (the
+  sides' dx/dy) from one scanline to the next.
+
+  FillOutlinedQuad works from the sides' edge functions instead, normalized
+  so that each gives the distance (in pixels) of a point from its side,
+  positive inside. On each scanline the pixels at least -halfWidth from the
+  outlined sides (and inside the others) are the quad and its outline, and
+  those at least +halfWidth from them its inside, so every scanline is an
+  edge span, a face span and another edge span, with no pixel written
+  twice.
+*******************************************************************************/
+#include "QuadFill.h"
+#include "RasterUtilities.h"
+#include <algorithm>
+#include <cmath>
+
+
+/*############################################################################*/
+/*############################# Global Constants #############################*/
+/*############################################################################*/
+
+  /* How far (in pixels) the corners may stray from a true parallelogram. */
+static const float gQuadTolerance = 1.0f / 1024.0f;
+
+
+/*############################################################################*/
+/*########################## Local Helper Functions ##########################*/
+/*############################################################################*/
+
+  /*
+   * The x values a slab (the region between the line through [P] and the line
+   * through [Q], both along [dir]) covers on scanline [y].
+   */
+struct Slab
+{
+  double mLeft;
+  double mRight;
+  double mStep;
+
+    /* Non-Default Constructor. */
+  Slab(const Point &P, const Point &Q, const Vector &dir, double y)
+    : mLeft(0.0), mRight(0.0), mStep(static_cast<double>(dir.x) / dir.y)
+  {
+    const double xP = (P.x + (mStep * (y - P.y)));
+    const double xQ = (Q.x + (mStep * (y - Q.y)));
+    mLeft  = std::min(xP, xQ);
+    mRight = std::max(xP, xQ);
+  }
+
+    /* Move on to the next scanline. */
+  void Step(void)
+  {
+    mLeft  += mStep;
+    mRight += mStep;
+  }
+};
+
+
+  /*
+   * The edge function of the side [P][Q] of a quad, normalized to give the
+   * distance of a point from the side (positive on the side of [inside]).
+   */
+struct EdgeDistance
+{
+  double mA;
+  double mB;
+  double mC;
+    /* 1 / mA (0 for a side running along a scanline). */
+  double mInvA;
+
+    /* Non-Default Constructor. */
+  EdgeDistance(const Point &P, const Point &Q, const Point &inside)
+    : mA(static_cast<double>(P.y) - Q.y), mB(static_cast<double>(Q.x) - P.x), mC(0.0),
+      mInvA(0.0)
+  {
+    const double length = std::hypot(mA, mB);
+    mA /= length;
+    mB /= length;
+    mC  = -((mA * P.x) + (mB * P.y));
+    if (((mA * inside.x) + (mB * inside.y) + mC) < 0.0)
+    {
+      mA = -mA;
+      mB = -mB;
+      mC = -mC;
+    }
+    if (mA != 0.0)
+      mInvA = (1.0 / mA);
+  }
+
+    /* Narrow [left, right] to the x on scanline [y] at least [t] from the side. */
+  void Narrow(double y, double t, double &left, double &right) const
+  {
+    const double rest = ((mB * y) + mC - t);
+    if (mA == 0.0)
+    {
+      if (rest < 0.0)
+        left = (right + 1.0);
+    }
+    else if (0.0 < mA)
+      left  = std::max(left,  (-rest * mInvA));
+    else
+      right = std::min(right, (-rest * mInvA));
+  }
+};
+
+  /*
+   * The y of the point [t] from the side [s] and [u] from the side [r]
+   * (which are not parallel).
+   */
+static double CornerY(const EdgeDistance &s, double t, const EdgeDistance &r, double u)
+{
+  const double det = ((s.mA * r.mB) - (r.mA * s.mB));
+  return (((s.mA * (u - r.mC)) - (r.mA * (t - s.mC))) / det);
+}
+
+
+/*############################################################################*/
+/*######################### Function Implementation ##########################*/
+/*############################################################################*/
+
+/*!
+******************************************************************************
+  \fn bool FillQuad(Raster &raster, const Point &A, const Point &B,
+                    const Point &C, const Point &D)
+
+  \brief
+    Fill the quad [A][B][C][D] if it is a parallelogram.
+
+  \param raster
+    The Raster object that the quad will be drawn to.
+
+  \param A, B, C, D
+    The corners of the quad, in order, in device coordinates.
+
+  \return
+    Whether the quad was a parallelogram (and so was drawn).
+*******************************************************************************/
+bool FillQuad(      Raster &raster,
+              const Point  &A,
+              const Point  &B,
+              const Point  &C,
+              const Point  &D)
+{
+    /* The diagonals of a parallelogram share their midpoint. */
+  if ((std::fabs((A.x + C.x) - (B.x + D.x)) > gQuadTolerance) ||
+      (std::fabs((A.y + C.y) - (B.y + D.y)) > gQuadTolerance))
+    return false;
+
+  const Vector AB   = (B - A);
+  const Vector AD   = (D - A);
+  const float  wMax = static_cast<float>(raster.Width()  - 1);
+  const float  hMax = static_cast<float>(raster.Height() - 1);
+  const float  yMin = std::max(std::min(std::min(A.y, B.y), std::min(C.y, D.y)), 0.0f);
+  const float  yMax = std::min(std::max(std::max(A.y, B.y), std::max(C.y, D.y)), hMax);
+
+    /* Leave degenerate quads to the general path. */
+  if (((AB.x * AD.y) - (AB.y * AD.x)) == 0.0f)
+    return false;
+  if (yMax <= yMin)
+    return true;
+
+  const int y0 = static_cast<int>(std::ceil(yMin));
+  const int y1 = static_cast<int>(std::ceil(yMax));
+
+    /* Axis-aligned rectangles are filled directly. */
+  if (((AB.y == 0.0f) && (AD.x == 0.0f)) || ((AB.x == 0.0f) && (AD.y == 0.0f)))
+  {
+    const float xMin = std::max(std::min(A.x, C.x), 0.0f);
+    const float xMax = std::min(std::max(A.x, C.x), wMax);
+    if (xMax <= xMin)
+      return true;
+
+    const int x0 = static_cast<int>(std::ceil(xMin));
+    const int x1 = static_cast<int>(std::ceil(xMax));
+    if ((x0 < x1) && (y0 < y1))
+      FillRect(raster, x0, y0, (x1 - x0), (y1 - y0));
+    return true;
+  }
+
+    /*
+     * Sides running along a scanline bound the quad's scanlines rather than
+     * its spans, so only the slabs between slanted sides are walked.
+     */
+  const double y          = static_cast<double>(y0);
+  const bool   hasSlabAB  = (AB.y != 0.0f);
+  const bool   hasSlabAD  = (AD.y != 0.0f);
+  Slab         slabAB     = (hasSlabAB ? Slab(A, D, AB, y) : Slab(A, A, AD, y));
+  Slab         slabAD     = (hasSlabAD ? Slab(A, B, AD, y) : Slab(A, A, AB, y));
+
+  for (int row = y0; row < y1; ++row, slabAB.Step(), slabAD.Step())
+  {
+    double left  = 0.0;
+    double right = wMax;
+    if (hasSlabAB)
+    {
+      left  = std::max(left,  slabAB.mLeft);
+      right = std::min(right, slabAB.mRight);
+    }
+    if (hasSlabAD)
+    {
+      left  = std::max(left,  slabAD.mLeft);
+      right = std::min(right, slabAD.mRight);
+    }
+    if (right <= left)
+      continue;
+
+    const int x0 = static_cast<int>(std::ceil(left));
+    const int x1 = static_cast<int>(std::ceil(right));
+    if (x0 < x1)
+    {
+      raster.GotoPoint(x0, row);
+      raster.WriteSpan(x1 - x0);
+    }
+  }
+
+  return true;
+}
+
+/*!
+******************************************************************************
+  \fn bool FillOutlinedQuad(Raster &raster, const Point &A, const Point &B,
+                            const Point &C, const Point &D, unsigned outlined,
+                            float halfWidth, const Color &faceColor,
+                            const Color &edgeColor)
+
+  \brief
+    Fill the quad [A][B][C][D] if it is a parallelogram, outlining the sides
+    flagged in [outlined] in the same pass.
+
+  \param raster
+    The Raster object that the quad will be drawn to.
+
+  \param A, B, C, D
+    The corners of the quad, in order, in device coordinates.
+
+  \param outlined
+    The sides to outline: bit 0 for AB, bit 1 for BC, bit 2 for CD and bit 3
+    for DA.
+
+  \param halfWidth
+    How far (in pixels) the outline reaches to either side of a side.
+
+  \param faceColor
+    The color to fill the quad with.
+
+  \param edgeColor
+    The color to outline the quad with.
+
+  \return
+    Whether the quad was a parallelogram (and so was drawn).
+*******************************************************************************/
+bool FillOutlinedQuad(      Raster   &raster,
+                      const Point    &A,
+                      const Point    &B,
+                      const Point    &C,
+                      const Point    &D,
+                            unsigned  outlined,
+                            float     halfWidth,
+                      const Color    &faceColor,
+                      const Color    &edgeColor)
+{
+  if ((std::fabs((A.x + C.x) - (B.x + D.x)) > gQuadTolerance) ||
+      (std::fabs((A.y + C.y) - (B.y + D.y)) > gQuadTolerance))
+    return false;
+
+  const Vector AB = (B - A);
+  const Vector AD = (D - A);
+  if (((AB.x * AD.y) - (AB.y * AD.x)) == 0.0f)
+    return false;
+
+    /* Each side's distance from the outline (outer) and from the face (inner). */
+  const EdgeDistance sides[4] = { EdgeDistance(A, B, C), EdgeDistance(B, C, D),
+                                  EdgeDistance(C, D, A), EdgeDistance(D, A, B) };
+  double outer[4];
+  double inner[4];
+  for (int i = 0; i < 4; ++i)
+  {
+    const bool flagged = ((outlined & (1u << i)) != 0);
+    outer[i] = (flagged ? -halfWidth : 0.0);
+    inner[i] = (flagged ?  halfWidth : 0.0);
+  }
+
+    /* The scanlines the quad and its outline cover, clipped to the screen. */
+  const double wMax = static_cast<double>(raster.Width()  - 1);
+  const double hMax = static_cast<double>(raster.Height() - 1);
+  double       yMin = hMax;
+  double       yMax = 0.0;
+  for (int i = 0; i < 4; ++i)
+  {
+    const double y = CornerY(sides[i], outer[i], sides[(i + 1) & 3], outer[(i + 1) & 3]);
+    yMin = std::min(yMin, y);
+    yMax = std::max(yMax, y);
+  }
+  yMin = std::max(yMin, 0.0);
+  yMax = std::min(yMax, hMax);
+  if (yMax <= yMin)
+    return true;
+
+  const int y0 = static_cast<int>(std::ceil(yMin));
+  const int y1 = static_cast<int>(std::ceil(yMax));
+  for (int row = y0; row < y1; ++row)
+  {
+    const double y       = static_cast<double>(row);
+    double       left    = 0.0;
+    double       right   = wMax;
+    double       inLeft  = 0.0;
+    double       inRight = wMax;
+    for (int i = 0; i < 4; ++i)
+    {
+      sides[i].Narrow(y, outer[i], left,   right);
+      sides[i].Narrow(y, inner[i], inLeft, inRight);
+    }
+    if (right <= left)
+      continue;
+
+    const int x0 = static_cast<int>(std::ceil(left));
+    const int x1 = static_cast<int>(std::ceil(right));
+    int       i0 = x1;
+    int       i1 = x1;
+    if (inLeft < inRight)
+    {
+      i0 = std::min(std::max(static_cast<int>(std::ceil(inLeft)), x0), x1);
+      i1 = std::min(std::max(static_cast<int>(std::ceil(inRight)), i0), x1);
+    }
+
+    raster.SetColor(edgeColor.red, edgeColor.grn, edgeColor.blu);
+    if (x0 < i0)
+    {
+      raster.GotoPoint(x0, row);
+      raster.WriteSpan(i0 - x0);
+    }
+    if (i1 < x1)
+    {
+      raster.GotoPoint(i1, row);
+      raster.WriteSpan(x1 - i1);
+    }
+    if (i0 < i1)
+    {
+      raster.SetColor(faceColor.red, faceColor.grn, faceColor.blu);
+      raster.GotoPoint(i0, row);
+      raster.WriteSpan(i1 - i0);
+    }
+  }
+
+  return true;
+}
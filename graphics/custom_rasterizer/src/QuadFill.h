@@ -0,0 +1,67 @@
+/*!
+*****************************************************************************
+\file   QuadFill.h
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the prototypes of FillQuad, which fills parallelograms
+  (such as squares seen through an affine camera) without splitting them
+  into triangles, and FillOutlinedQuad, which outlines them in the same
+  pass.
+*******************************************************************************/
+#ifndef QUADFILL_H
+#define QUADFILL_H
+
+#include "Affine.h"
+#include "Color.h"
+#include "Raster.h"
+
+
+/*############################################################################*/
+/*########################### Function Prototypes ############################*/
+/*############################################################################*/
+
+  /*
+   * If the quad [A][B][C][D] (corners in order, in device coordinates) is a
+   * parallelogram, fill it to the Raster object's pixel buffer (clipped to
+   * the screen) in the current foreground color and return true. Otherwise
+   * draw nothing and return false. The pixels filled are the same as
+   * clipping the triangles ABC and ACD to the screen and filling them with
+   * FillTriangle (except along the very edge of the screen, where the
+   * clipped triangles are at the mercy of the clipper's rounding). Axis-
+   * aligned rectangles are filled with FillRect, and other parallelograms
+   * one span per scanline, stepping both ends of the span by a constant
+   * amount per scanline.
+   */
+bool FillQuad(      Raster &raster,
+              const Point  &A,
+              const Point  &B,
+              const Point  &C,
+              const Point  &D);
+  /*
+   * Like FillQuad(), but outline the sides of the parallelogram flagged in
+   * [outlined] (bit 0 for side AB, bit 1 for BC, bit 2 for CD and bit 3 for
+   * DA) in [edgeColor] in the same pass. A pixel whose distance to a flagged
+   * side (by the side's edge function) is within [halfWidth] takes the edge
+   * color, the other pixels inside take [faceColor], and each is clipped
+   * and written once. The outline differs from DrawLine's by up to a pixel,
+   * since it is picked by distance rather than stepped along the side.
+   */
+bool FillOutlinedQuad(      Raster   &raster,
+                      const Point    &A,
+                      const Point    &B,
+                      const Point    &C,
+                      const Point    &D,
+                            unsigned  outlined,
+                            float     halfWidth,
+                      const Color    &faceColor,
+                      const Color    &edgeColor);
+
+
+#endif
+
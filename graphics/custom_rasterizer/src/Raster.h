@@ -14,7 +14,14 @@
 #ifndef CS200_RASTER_H
 #define CS200_RASTER_H
 
+#include "AlphaBlend.h"
+#include "FixedPoint.h"
+#include "GammaBlend.h"
+#include "SampleBuffer.h"
+#include "SpanBuffer.h"
 #include <cassert>
+#include <cstddef>
+#include <cstring>
 
 
 class Raster
@@ -46,6 +53,48 @@ public:
      * foreground color. See the comments below.
      */
   void WritePixel(void);
+    /*
+     * Writes [count] pixels to the frame buffer, starting at the current point
+     * and moving right, in the current foreground color. The current point is
+     * not moved.
+     */
+  void WriteSpan(int count);
+    /*
+     * Writes [count] pixels to the frame buffer like WriteSpan, but in colors
+     * that start at the fixed point [start] (red, green, blue) and change by
+     * [step] per pixel, rather than in the current foreground color. Each
+     * channel must stay within [0, 256) over the span.
+     */
+  void WriteShadedSpan(int count, const Fixed start[3], const Fixed step[3]);
+    /*
+     * Writes [count] pixels to the frame buffer like WriteSpan, but in the
+     * colors at [pRgb] (three bytes per pixel: red, green, blue) rather than
+     * in the current foreground color.
+     */
+  void WritePixels(int count, const byte *pRgb);
+    /*
+     * Mixes the current foreground color into the pixel at the current point
+     * by [weight] / gFullWeight (scaled by the current alpha), in linear
+     * light (see BlendChannel()). The pixel is not checked against the
+     * coverage (see SetCoverage()).
+     */
+  void BlendPixel(int weight);
+
+  /********************************* Getters **********************************/
+    /* Get the width (in pixels) of the frame buffer. */
+  int Width(void) const;
+    /* Get the height (in pixels) of the frame buffer. */
+  int Height(void) const;
+    /* Get the number of bytes taken up by each scan line. */
+  int Stride(void) const;
+    /* Get the address of the start of the frame buffer. */
+  byte *Buffer(void) const;
+    /* Get the SpanBuffer that writes are checked against (NULL if none). */
+  SpanBuffer *GetCoverage(void) const;
+    /* Get the SampleBuffer that writes drop samples from (NULL if none). */
+  SampleBuffer *GetSamples(void) const;
+    /* Get the opacity that pixels are written with. */
+  byte GetAlpha(void) const;
 
   /********************************* Setters **********************************/
     /*
@@ -55,6 +104,27 @@ public:
   void GotoPoint(int x, int y);
     /* Sets the current foreground color. */
   void SetColor(byte r, byte g, byte b);
+    /*
+     * Sets the opacity (0 to gOpaqueAlpha, the default) that the pixels
+     * written from now on are drawn over the frame buffer with, blending
+     * them with what is already there (source-over) unless they are fully
+     * opaque. Meant for drawing back to front: writes checked against a
+     * coverage (see SetCoverage()) stay opaque.
+     */
+  void SetAlpha(byte a);
+    /*
+     * Only write the pixels that [pCoverage] reports as still free (marking
+     * them as covered), so that opaque geometry can be drawn front to back.
+     * NULL writes every pixel again.
+     */
+  void SetCoverage(SpanBuffer *pCoverage);
+    /*
+     * Drop the samples [pSamples] holds for the pixels written, which cover
+     * them whole, so that multisampled edges drawn earlier do not show
+     * through once it is resolved. NULL stops dropping them. Meant for
+     * drawing back to front, not together with SetCoverage().
+     */
+  void SetSamples(SampleBuffer *pSamples);
 
   /********************************* Mutators *********************************/
     /* Moves the current point one pixel to the right. */
@@ -67,6 +137,44 @@ public:
   void DecrementY(void);
 
 
+/*############################################################################*/
+/*############################# Private Defines ##############################*/
+/*############################################################################*/
+private:
+    /* Number of pixels shaded at a time before being blended. */
+  static const int scmBlendChunk = 64;
+    /* The pixels a span write is left with once set up (see BeginSpan()). */
+  struct SpanWrite
+  {
+      /* The index of the first pixel to write, and its x coordinate. */
+    int                                  mIndex;
+    int                                  mFirst;
+      /* The number of pixels trimmed off the front of the span. */
+    int                                  mSkip;
+      /* The number of pixels left to write (0 or less for none). */
+    int                                  mCount;
+      /* The parts of them still free to write (NULL without a coverage). */
+    const std::vector<SpanBuffer::Span> *mpFree;
+  };
+
+
+/*############################################################################*/
+/*############################# Private Methods ##############################*/
+/*############################################################################*/
+private:
+    /*
+     * Set up writing [count] pixels from the current point: trim them to the
+     * frame buffer, release their samples and claim the free parts of them
+     * from the coverage (when set).
+     */
+  SpanWrite BeginSpan(int count);
+    /*
+     * Drop the samples of the [count] pixels starting at [index] about to be
+     * written (or, when blending, resolve them to be blended with).
+     */
+  void ReleaseSamples(int index, int count);
+
+
 /*############################################################################*/
 /*############################# Private Members ##############################*/
 /*############################################################################*/
@@ -81,6 +189,9 @@ private:
   byte red;
   byte green;
   byte blue;
+  byte alpha;
+  SpanBuffer *coverage;
+  SampleBuffer *samples;
 };
 
 
@@ -113,7 +224,7 @@ private:
 inline
 Raster::Raster(byte *d, int w, int h, int s)
 : buffer(d), width(w), height(h), stride(s),
-red(0), green(0), blue(0)
+red(0), green(0), blue(0), alpha(gOpaqueAlpha), coverage(NULL), samples(NULL)
 {
 }
 
@@ -138,11 +249,313 @@ void Raster::WritePixel(void)
          (0 <= current_y) && (current_y < height));
 #endif
   int index = current_index;
+  if (coverage || samples)
+  {
+      /* The current point is only kept as an index, so recover it from that. */
+    int y = (index / stride);
+    int x = ((index - (y * stride)) / 3);
+    if (coverage && !coverage->Claim(x, y))
+      return;
+    if (samples)
+      ReleaseSamples(index, 1);
+  }
+  if ((alpha != gOpaqueAlpha) && !coverage)
+  {
+    const int inv = (gOpaqueAlpha - alpha);
+    buffer[index]     = static_cast<byte>(Div255((red   * alpha) + (buffer[index]     * inv)));
+    buffer[index + 1] = static_cast<byte>(Div255((green * alpha) + (buffer[index + 1] * inv)));
+    buffer[index + 2] = static_cast<byte>(Div255((blue  * alpha) + (buffer[index + 2] * inv)));
+    return;
+  }
   buffer[index]   = red;
   buffer[++index] = green;
   buffer[++index] = blue;
 }
 
+/*!
+******************************************************************************
+  \fn WriteSpan(int count)
+
+  \brief
+    Writes [count] pixels to the frame buffer, starting at the current point
+    and moving right, in the current foreground color. The current point is
+    not moved.
+*******************************************************************************/
+inline
+void Raster::WriteSpan(int count)
+{
+  const SpanWrite span = BeginSpan(count);
+  if (span.mCount <= 0)
+    return;
+  if (span.mpFree)
+  {
+    for (auto run = span.mpFree->begin(); run != span.mpFree->end(); ++run)
+      for (int i = (span.mIndex + (3 * (run->mX0 - span.mFirst))), n = (run->mX1 - run->mX0);
+           0 < n; --n, i += 3)
+      {
+        buffer[i]     = red;
+        buffer[i + 1] = green;
+        buffer[i + 2] = blue;
+      }
+    return;
+  }
+  if (alpha != gOpaqueAlpha)
+  {
+    BlendColorSpan(&buffer[span.mIndex], span.mCount, red, green, blue, alpha);
+    return;
+  }
+  for (int index = span.mIndex, n = span.mCount; 0 < n; --n, index += 3)
+  {
+    buffer[index]     = red;
+    buffer[index + 1] = green;
+    buffer[index + 2] = blue;
+  }
+}
+
+/*!
+******************************************************************************
+  \fn WriteShadedSpan(int count, const Fixed start[3], const Fixed step[3])
+
+  \brief
+    Writes [count] pixels to the frame buffer like WriteSpan, but in colors
+    that start at the fixed point [start] (red, green, blue) and change by
+    [step] per pixel, rather than in the current foreground color. Each
+    channel must stay within [0, 256) over the span.
+*******************************************************************************/
+inline
+void Raster::WriteShadedSpan(int count, const Fixed start[3], const Fixed step[3])
+{
+  const SpanWrite span = BeginSpan(count);
+  if (span.mCount <= 0)
+    return;
+  int   index = span.mIndex;
+  count       = span.mCount;
+    /* The colors at the first pixel left to write. */
+  Fixed r     = (start[0] + (step[0] * span.mSkip));
+  Fixed g     = (start[1] + (step[1] * span.mSkip));
+  Fixed b     = (start[2] + (step[2] * span.mSkip));
+  if (span.mpFree)
+  {
+    for (auto run = span.mpFree->begin(); run != span.mpFree->end(); ++run)
+    {
+      const int skip = (run->mX0 - span.mFirst);
+      Fixed     rr   = (r + (step[0] * skip));
+      Fixed     gg   = (g + (step[1] * skip));
+      Fixed     bb   = (b + (step[2] * skip));
+      for (int i = (index + (3 * skip)), n = (run->mX1 - run->mX0);
+           0 < n; --n, i += 3, rr += step[0], gg += step[1], bb += step[2])
+      {
+        buffer[i]     = static_cast<byte>(rr >> gFracBits);
+        buffer[i + 1] = static_cast<byte>(gg >> gFracBits);
+        buffer[i + 2] = static_cast<byte>(bb >> gFracBits);
+      }
+    }
+    return;
+  }
+  if (alpha != gOpaqueAlpha)
+  {
+      /*
+       * Shade the span premultiplied by the alpha (scaling the colors and
+       * their steps up front), a chunk at a time, and draw it over. The colors
+       * are nudged up a hair so that rounding in the steps never takes them
+       * below zero.
+       */
+    const Fixed nudge    = (gFixedOne >> 16);
+    const Fixed pStep[3] = { ((step[0] * alpha) / gOpaqueAlpha),
+                             ((step[1] * alpha) / gOpaqueAlpha),
+                             ((step[2] * alpha) / gOpaqueAlpha) };
+    Fixed       pr       = (((r * alpha) / gOpaqueAlpha) + nudge);
+    Fixed       pg       = (((g * alpha) / gOpaqueAlpha) + nudge);
+    Fixed       pb       = (((b * alpha) / gOpaqueAlpha) + nudge);
+    byte        rgb[3 * scmBlendChunk];
+    for (int done = 0; done < count; done += scmBlendChunk)
+    {
+      const int n = (((count - done) < scmBlendChunk) ? (count - done) : scmBlendChunk);
+      for (int i = 0; i < (3 * n); i += 3, pr += pStep[0], pg += pStep[1], pb += pStep[2])
+      {
+        rgb[i]     = static_cast<byte>(pr >> gFracBits);
+        rgb[i + 1] = static_cast<byte>(pg >> gFracBits);
+        rgb[i + 2] = static_cast<byte>(pb >> gFracBits);
+      }
+      BlendPremultipliedSpan(&buffer[index + (3 * done)], rgb, n, alpha);
+    }
+    return;
+  }
+  for (/* count = count */; 0 < count; --count, index += 3,
+       r += step[0], g += step[1], b += step[2])
+  {
+    buffer[index]     = static_cast<byte>(r >> gFracBits);
+    buffer[index + 1] = static_cast<byte>(g >> gFracBits);
+    buffer[index + 2] = static_cast<byte>(b >> gFracBits);
+  }
+}
+
+/*!
+******************************************************************************
+  \fn WritePixels(int count, const byte *pRgb)
+
+  \brief
+    Writes [count] pixels to the frame buffer like WriteSpan, but in the
+    colors at [pRgb] (three bytes per pixel: red, green, blue) rather than
+    in the current foreground color.
+*******************************************************************************/
+inline
+void Raster::WritePixels(int count, const byte *pRgb)
+{
+  const SpanWrite span = BeginSpan(count);
+  if (span.mCount <= 0)
+    return;
+  pRgb += (3 * span.mSkip);
+  if (span.mpFree)
+  {
+    for (auto run = span.mpFree->begin(); run != span.mpFree->end(); ++run)
+      std::memcpy(&buffer[span.mIndex + (3 * (run->mX0 - span.mFirst))],
+                  (pRgb + (3 * (run->mX0 - span.mFirst))),
+                  (3 * static_cast<std::size_t>(run->mX1 - run->mX0)));
+    return;
+  }
+  if (alpha != gOpaqueAlpha)
+    BlendPixelSpan(&buffer[span.mIndex], pRgb, span.mCount, alpha);
+  else
+    std::memcpy(&buffer[span.mIndex], pRgb, (3 * static_cast<std::size_t>(span.mCount)));
+}
+
+/*!
+******************************************************************************
+  \fn BlendPixel(int weight)
+
+  \brief
+    Mixes the current foreground color into the pixel at the current point
+    by [weight] / gFullWeight (scaled by the current alpha), in linear
+    light (see BlendChannel()). The pixel is not checked against the
+    coverage (see SetCoverage()).
+*******************************************************************************/
+inline
+void Raster::BlendPixel(int weight)
+{
+#ifdef CLIP_PIXELS
+  if ((current_x < 0) || (width  <= current_x) ||
+      (current_y < 0) || (height <= current_y))
+      return;
+#endif
+#ifndef NDEBUG
+  assert((0 <= current_x) && (current_x < width) &&
+         (0 <= current_y) && (current_y < height));
+#endif
+  if (alpha != gOpaqueAlpha)
+    weight = (((weight * alpha) + (gOpaqueAlpha / 2)) / gOpaqueAlpha);
+  if (weight <= 0)
+    return;
+  int index = current_index;
+  if (samples)
+  {
+      /* Blend with what the pixel's samples add up to. */
+    int y = (index / stride);
+    samples->ResolvePixels(((index - (y * stride)) / 3), y, 1, &buffer[index]);
+  }
+  if (gFullWeight <= weight)
+  {
+    buffer[index]     = red;
+    buffer[index + 1] = green;
+    buffer[index + 2] = blue;
+    return;
+  }
+  buffer[index]     = BlendChannel(buffer[index],     red,   weight);
+  buffer[index + 1] = BlendChannel(buffer[index + 1], green, weight);
+  buffer[index + 2] = BlendChannel(buffer[index + 2], blue,  weight);
+}
+
+/*!
+******************************************************************************
+  \fn Width(void)
+
+  \brief
+    Get the width (in pixels) of the frame buffer.
+*******************************************************************************/
+inline
+int Raster::Width(void) const
+{
+  return width;
+}
+
+/*!
+******************************************************************************
+  \fn Height(void)
+
+  \brief
+    Get the height (in pixels) of the frame buffer.
+*******************************************************************************/
+inline
+int Raster::Height(void) const
+{
+  return height;
+}
+
+/*!
+******************************************************************************
+  \fn Stride(void)
+
+  \brief
+    Get the number of bytes taken up by each scan line.
+*******************************************************************************/
+inline
+int Raster::Stride(void) const
+{
+  return stride;
+}
+
+/*!
+******************************************************************************
+  \fn Buffer(void)
+
+  \brief
+    Get the address of the start of the frame buffer.
+*******************************************************************************/
+inline
+Raster::byte *Raster::Buffer(void) const
+{
+  return buffer;
+}
+
+/*!
+******************************************************************************
+  \fn GetCoverage(void)
+
+  \brief
+    Get the SpanBuffer that writes are checked against (NULL if none).
+*******************************************************************************/
+inline
+SpanBuffer *Raster::GetCoverage(void) const
+{
+  return coverage;
+}
+
+/*!
+******************************************************************************
+  \fn GetSamples(void)
+
+  \brief
+    Get the SampleBuffer that writes drop samples from (NULL if none).
+*******************************************************************************/
+inline
+SampleBuffer *Raster::GetSamples(void) const
+{
+  return samples;
+}
+
+/*!
+******************************************************************************
+  \fn GetAlpha(void)
+
+  \brief
+    Get the opacity that pixels are written with.
+*******************************************************************************/
+inline
+Raster::byte Raster::GetAlpha(void) const
+{
+  return alpha;
+}
+
 /*!
 ******************************************************************************
   \fn GotoPoint(int x, int y)
@@ -176,6 +589,128 @@ void Raster::SetColor(byte r, byte g, byte b)
   blue  = b;
 }
 
+/*!
+******************************************************************************
+  \fn SetAlpha(byte a)
+
+  \brief
+    Sets the opacity (0 to gOpaqueAlpha, the default) that the pixels
+    written from now on are drawn over the frame buffer with, blending them
+    with what is already there (source-over) unless they are fully opaque.
+    Meant for drawing back to front: writes checked against a coverage (see
+    SetCoverage()) stay opaque.
+*******************************************************************************/
+inline
+void Raster::SetAlpha(byte a)
+{
+  alpha = a;
+}
+
+/*!
+******************************************************************************
+  \fn SetCoverage(SpanBuffer *pCoverage)
+
+  \brief
+    Only write the pixels that [pCoverage] reports as still free (marking
+    them as covered), so that opaque geometry can be drawn front to back.
+    NULL writes every pixel again.
+*******************************************************************************/
+inline
+void Raster::SetCoverage(SpanBuffer *pCoverage)
+{
+  coverage = pCoverage;
+}
+
+/*!
+******************************************************************************
+  \fn SetSamples(SampleBuffer *pSamples)
+
+  \brief
+    Drop the samples [pSamples] holds for the pixels written, which cover
+    them whole, so that multisampled edges drawn earlier do not show
+    through once it is resolved. NULL stops dropping them. Meant for
+    drawing back to front, not together with SetCoverage().
+*******************************************************************************/
+inline
+void Raster::SetSamples(SampleBuffer *pSamples)
+{
+  samples = pSamples;
+}
+
+/*!
+******************************************************************************
+  \fn BeginSpan(int count)
+
+  \brief
+    Set up writing [count] pixels from the current point, moving right: trim
+    them to the frame buffer, drop (or resolve) their samples, and claim the
+    parts of them still free from the coverage (when set). Each span writer
+    then only has to write the pixels left.
+*******************************************************************************/
+inline
+Raster::SpanWrite Raster::BeginSpan(int count)
+{
+  SpanWrite span;
+  span.mIndex = current_index;
+  span.mFirst = 0;
+  span.mSkip  = 0;
+  span.mCount = 0;
+  span.mpFree = NULL;
+#ifdef CLIP_PIXELS
+  if ((current_y < 0) || (height <= current_y))
+    return span;
+    /* Trim the span to the frame buffer. */
+  int x0 = current_x;
+  int x1 = (current_x + count);
+  if (x0 < 0)
+  {
+    span.mIndex -= (3 * x0);
+    span.mSkip   = -x0;
+    x0           = 0;
+  }
+  if (width < x1)
+    x1 = width;
+  count = (x1 - x0);
+#endif
+#ifndef NDEBUG
+  assert((count <= 0) ||
+         ((0 <= current_y) && (current_y < height)));
+#endif
+  if (count <= 0)
+    return span;
+  span.mCount = count;
+  if (samples)
+    ReleaseSamples(span.mIndex, count);
+  if (coverage)
+  {
+      /* Only write the parts of the span that are still free. */
+    int y       = (span.mIndex / stride);
+    span.mFirst = ((span.mIndex - (y * stride)) / 3);
+    span.mpFree = &coverage->ClaimSpan(y, span.mFirst, (span.mFirst + count));
+  }
+  return span;
+}
+
+/*!
+******************************************************************************
+  \fn ReleaseSamples(int index, int count)
+
+  \brief
+    Drop the samples of the [count] pixels starting at [index] about to be
+    written, which cover them whole, or when blending, resolve them so the
+    pixels hold what their samples add up to.
+*******************************************************************************/
+inline
+void Raster::ReleaseSamples(int index, int count)
+{
+  int y = (index / stride);
+  int x = ((index - (y * stride)) / 3);
+  if (alpha == gOpaqueAlpha)
+    samples->Drop(x, y, count);
+  else
+    samples->ResolvePixels(x, y, count, &buffer[index]);
+}
+
 /*!
 ******************************************************************************
   \fn IncrementX(void)
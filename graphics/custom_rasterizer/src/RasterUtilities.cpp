@@ -17,19 +17,8 @@
 *******************************************************************************/
 #include "RasterUtilities.h"
 
-/* 
-  * To prevent needless GotoPoint calls, 
-  * we are going to traverse back and forth in the x-direction. 
-  *   The first  row will be traversed from x0 to x1, 
-  *   The second row will be traversed from x1 to x0, 
-  *   The third  row will be traversed from x0 to x1 again, etc. 
-  */
-
-  /* Typedef the pointer-to-member-function needed to call (In/De)crementX. */
+  /* Typedef the pointer-to-member-function needed to call (In/De)crement(X/Y). */
 typedef void (Raster::*RasterIterator)(void);
-  /* Create a static array referencing both functions used to iterate X. */
-static const RasterIterator Traversals[] = { &Raster::IncrementX, 
-                                             &Raster::DecrementX };
   /* Macro used to make calls to pointer-to-member-function more readable. */
 #define ITERATE(raster, traversal) (raster.*traversal)()
 
@@ -43,31 +32,11 @@ static void DrawRightLine(Raster &raster, RasterIterator iterate, int length);
  */
 void FillRect(Raster &raster, int x, int y, int width, int height)
 {
-    /* Go to the starting point of the rectangle being drawn. */
-  raster.GotoPoint(x, y);
-    /* 
-     * Prevent writing offset that occurs when switching 
-     * from iterating in one direction to another. 
-     */
-  --width;
-
-    /* Loop through each row of the rectangle. */
+    /* Write each row of the rectangle as one span. */
   for (int iRow = 0; iRow < height; ++iRow)
   {
-      /* Set the function currently needed to iterate along the x-axis. */
-    const RasterIterator &fnTraverseX = Traversals[iRow % 2];
-      /* Loop through each pixel in the row setting its color. */
-    for (int iCol = 0; iCol < width; ++iCol)
-    {
-        /* Set the the current pixel in the buffer to the foreground color. */
-      raster.WritePixel();
-        /* Move to the next un-written to pixel in the current row. */
-      ITERATE(raster, fnTraverseX);
-    }
-      /* Set the the current pixel in the buffer to the foreground color. */
-    raster.WritePixel();
-      /* Move up to the next row. */
-    raster.IncrementY();
+    raster.GotoPoint(x, (y + iRow));
+    raster.WriteSpan(width);
   }
 }
 
@@ -0,0 +1,169 @@
+/*!
+*****************************************************************************
+\file   Reprojection.cpp
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the implementation of the BackgroundReprojector class'
+  methods.
+
+  The frame's pixel (x, y) maps to the reference pixel
+    (ax + by + c, dx + ey + f),
+  so along a scanline the reference coordinates start at (by + c, ey + f)
+  for x = 0 and change by (a, d) per pixel. Both are stepped in 32.32 fixed
+  point offset by half a pixel, so dropping the fraction gives the nearest
+  reference pixel, and the run of pixels that land inside the reference is
+  found up front rather than tested pixel by pixel.
+*******************************************************************************/
+#include "Reprojection.h"
+#include "FixedPoint.h"
+#include "LayerCache.h"
+#include <cstring>
+
+
+/*############################################################################*/
+/*############################## Public Defines ##############################*/
+/*############################################################################*/
+
+const int BackgroundReprojector::scmMaxAge;
+const int BackgroundReprojector::scmMaxExposedDivisor;
+
+
+/*############################################################################*/
+/*############################## Public Methods ##############################*/
+/*############################################################################*/
+
+  /* Default Constructor. */
+BackgroundReprojector::BackgroundReprojector(void)
+  : mPixels(),
+    mWidth(0),
+    mHeight(0),
+    mStride(0),
+    mWorldToDev(),
+    mVersion(0),
+    mValid(false),
+    mAge(0),
+    mLastWorldToDev(),
+    mExposed(0),
+    mSpans() { ; }
+
+  /* Number of pixels the last frame had to draw from scratch. */
+int BackgroundReprojector::ExposedPixels(void) const
+{ return mExposed; }
+
+  /* Warp the reference into the new view. */
+bool BackgroundReprojector::Reproject(Raster &raster, const Affine &worldToDev, const CheckerGrid &grid, unsigned version)
+{
+  const bool heldStill = SameView(worldToDev, mLastWorldToDev);
+  mLastWorldToDev      = worldToDev;
+  mExposed             = (raster.Width() * raster.Height());
+
+    /*
+     * A camera that holds still gets an exact rendering instead, so that
+     * is what ends up in the static layer cache.
+     */
+  if (!mValid                       ||
+      (mWidth   != raster.Width())  ||
+      (mHeight  != raster.Height()) ||
+      (mStride  != raster.Stride()) ||
+      (mVersion != version)         ||
+      (mAge     >= scmMaxAge)       ||
+      heldStill)
+    return false;
+
+  const Affine devToWorld = Inverse(worldToDev);
+  const Affine newToRef   = (mWorldToDev * devToWorld);
+  const Fixed  dx         = ToFixed(newToRef[0][0]);
+  const Fixed  dy         = ToFixed(newToRef[1][0]);
+  const Fixed  width      = (static_cast<Fixed>(mWidth)  * gFixedOne);
+  const Fixed  height     = (static_cast<Fixed>(mHeight) * gFixedOne);
+
+    /* First find the warped span of each scanline to see what is exposed. */
+  int exposed = 0;
+  mSpans.resize(2 * mHeight);
+  for (int y = 0; y < mHeight; ++y)
+  {
+    const double fy = static_cast<double>(y);
+    const Fixed  x0 = ToFixed((newToRef[0][1] * fy) + newToRef[0][2] + 0.5);
+    const Fixed  y0 = ToFixed((newToRef[1][1] * fy) + newToRef[1][2] + 0.5);
+    Fixed        first = 0;
+    Fixed        last  = (mWidth - 1);
+
+    ClampToRange(x0, dx, width,  first, last);
+    ClampToRange(y0, dy, height, first, last);
+    if (last < first)
+    {
+      first = 0;
+      last  = -1;
+    }
+    mSpans[2 * y]       = static_cast<int>(first);
+    mSpans[(2 * y) + 1] = static_cast<int>(last);
+    exposed            += (mWidth - static_cast<int>(last - first + 1));
+  }
+  if ((exposed * scmMaxExposedDivisor) > (mWidth * mHeight))
+    return false;
+
+    /* Tiles only: the borders are drawn over them afterwards. */
+  CheckerGrid tiles = grid;
+  tiles.mBorders    = false;
+
+  Raster::byte       *pDst = raster.Buffer();
+  const Raster::byte *pSrc = &mPixels[0];
+  for (int y = 0; y < mHeight; ++y)
+  {
+    const int first = mSpans[2 * y];
+    const int last  = mSpans[(2 * y) + 1];
+
+      /* Draw the exposed pixels on either side of the warped span. */
+    if (last < first)
+    {
+      DrawCheckerboardRow(raster, devToWorld, tiles, y, 0, mWidth);
+      continue;
+    }
+    DrawCheckerboardRow(raster, devToWorld, tiles, y, 0, first);
+    DrawCheckerboardRow(raster, devToWorld, tiles, y, (last + 1), mWidth);
+
+      /* Copy the nearest reference pixel for the rest. */
+    const double        fy   = static_cast<double>(y);
+    Fixed               sx   = (ToFixed((newToRef[0][1] * fy) + newToRef[0][2] + 0.5) + (dx * first));
+    Fixed               sy   = (ToFixed((newToRef[1][1] * fy) + newToRef[1][2] + 0.5) + (dy * first));
+    Raster::byte       *pOut = (pDst + (static_cast<std::size_t>(y) * mStride) + (3 * first));
+    for (int x = first; x <= last; ++x, sx += dx, sy += dy, pOut += 3)
+    {
+      const Raster::byte *pIn = (pSrc + (static_cast<std::size_t>(sy >> gFracBits) * mStride) +
+                                 (3 * static_cast<std::size_t>(sx >> gFracBits)));
+      pOut[0] = pIn[0];
+      pOut[1] = pIn[1];
+      pOut[2] = pIn[2];
+    }
+  }
+
+  ++mAge;
+  mExposed = exposed;
+  return true;
+}
+
+  /* Keep the tiles just drawn as the new reference. */
+void BackgroundReprojector::Capture(const Raster &raster, const Affine &worldToDev, unsigned version)
+{
+  mWidth          = raster.Width();
+  mHeight         = raster.Height();
+  mStride         = raster.Stride();
+  mWorldToDev     = worldToDev;
+  mLastWorldToDev = worldToDev;
+  mVersion        = version;
+  mPixels.assign(raster.Buffer(),
+                 (raster.Buffer() + (static_cast<std::size_t>(mHeight) * mStride)));
+  mValid          = true;
+  mAge            = 0;
+  mExposed        = (mWidth * mHeight);
+}
+
+  /* Drop the reference. */
+void BackgroundReprojector::Invalidate(void)
+{ mValid = false; }
@@ -0,0 +1,114 @@
+/*!
+*****************************************************************************
+\file   Reprojection.h
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the definition of the BackgroundReprojector class, which
+  draws the background tiles of a moving camera by warping an earlier
+  rendering of them into the new view.
+*******************************************************************************/
+#ifndef REPROJECTION_H
+#define REPROJECTION_H
+
+#include "Affine.h"
+#include "Background.h"
+#include "Raster.h"
+#include <vector>
+
+
+/*!
+******************************************************************************
+  \class BackgroundReprojector
+
+  \brief
+    Keeps a reference rendering of the background's tiles (without their
+    borders) along with the view it was rendered through. While the camera
+    keeps moving, each new frame maps its pixels back into the reference
+    through the camera's change since then (reference world-to-device times
+    the inverse of the new world-to-device) and copies the nearest reference
+    pixel, walking each scanline in fixed point. Only the pixels the
+    reference does not cover (the newly exposed borders of the view) are
+    drawn from scratch (procedurally), and the caller draws the tile borders
+    exactly on top, which hides the (at most half a pixel) error along the tile edges.
+
+    Every frame is warped from the reference itself rather than from the
+    frame before, so resampling errors never build up. The caller renders
+    (and captures) a new reference whenever Reproject() declines: once the
+    reference gets too old, too much of the view would be exposed, or the
+    camera holds still (so that still frames are exact).
+*******************************************************************************/
+class BackgroundReprojector
+{
+/*############################################################################*/
+/*############################## Public Defines ##############################*/
+/*############################################################################*/
+public:
+    /* Number of frames a reference is reused for before it is rendered again. */
+  static const int scmMaxAge = 30;
+    /* Largest fraction (1 / n) of the screen that may be exposed. */
+  static const int scmMaxExposedDivisor = 4;
+
+
+/*############################################################################*/
+/*############################## Public Methods ##############################*/
+/*############################################################################*/
+public:
+
+  /******************************* Constructors *******************************/
+    /* Default Constructor. */
+  BackgroundReprojector(void);
+
+  /********************************* Getters **********************************/
+    /* Number of pixels the last frame had to draw from scratch. */
+  int ExposedPixels(void) const;
+
+  /********************************* Mutators *********************************/
+    /*
+     * Draw the tiles of [grid] (version [version]) to every pixel of the
+     * Raster object's frame buffer as seen through [worldToDev] by warping
+     * the reference into the new view. Returns false (drawing nothing) when
+     * a new reference should be rendered and captured instead.
+     */
+  bool Reproject(Raster &raster, const Affine &worldToDev, const CheckerGrid &grid, unsigned version);
+    /*
+     * Keep the tiles just drawn (without their borders) to [raster] through
+     * [worldToDev] as the new reference.
+     */
+  void Capture(const Raster &raster, const Affine &worldToDev, unsigned version);
+    /* Drop the reference. */
+  void Invalidate(void);
+
+
+/*############################################################################*/
+/*############################# Private Members ##############################*/
+/*############################################################################*/
+private:
+    /* The reference pixels (laid out exactly like the frame buffer). */
+  std::vector<Raster::byte> mPixels;
+    /* The layout of the frame buffer the reference was copied from. */
+  int                       mWidth;
+  int                       mHeight;
+  int                       mStride;
+    /* The view and grid version the reference was rendered with. */
+  Affine                    mWorldToDev;
+  unsigned                  mVersion;
+  bool                      mValid;
+    /* Number of frames the reference has been warped into. */
+  int                       mAge;
+    /* The view of the last frame drawn. */
+  Affine                    mLastWorldToDev;
+    /* Number of pixels the last frame had to draw from scratch. */
+  int                       mExposed;
+    /* The [first, last] warped pixels of each scanline of the frame. */
+  std::vector<int>          mSpans;
+};
+
+
+#endif
+
@@ -0,0 +1,244 @@
+/*!
+*****************************************************************************
+\file   SampleBuffer.h
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the definition of the SampleBuffer class, which holds
+  the samples of the pixels that multisampled geometry only partly covers.
+*******************************************************************************/
+#ifndef SAMPLEBUFFER_H
+#define SAMPLEBUFFER_H
+
+#include <cstddef>
+#include <vector>
+
+
+/*!
+******************************************************************************
+  \class SampleBuffer
+
+  \brief
+    Multisample storage for a frame buffer, kept sparse: a pixel covered by
+    a single color (every pixel, until an edge passes through it) is just
+    its color in the frame buffer, and only the pixels that edges leave
+    partly covered get a record. Most of those only ever hold two colors, so
+    a record starts out compressed, as the color the pixel had before plus
+    a second color and the mask of the samples holding it; only a third
+    color expands it to a color per sample. Either way, a pixel whose
+    samples all end up in the same color (such as along the edge between
+    two faces of one mesh) goes back to being just that color, and a write
+    covering the whole pixel drops its record. Resolving writes the average
+    of each record's samples back to the frame buffer and empties the
+    buffer.
+*******************************************************************************/
+class SampleBuffer
+{
+/*############################################################################*/
+/*############################## Public Defines ##############################*/
+/*############################################################################*/
+public:
+  typedef unsigned char byte;
+    /* The most samples a pixel may have (the bits of a coverage mask). */
+  static const int scmMaxSamples = 8;
+
+
+/*############################################################################*/
+/*############################## Public Methods ##############################*/
+/*############################################################################*/
+public:
+
+  /******************************* Constructors *******************************/
+    /* Default Constructor (no samples). */
+  SampleBuffer(void);
+
+  /********************************* Getters **********************************/
+    /* Get the number of samples per pixel. */
+  int Samples(void) const;
+    /* Get the coverage mask with a bit set for every sample. */
+  unsigned FullMask(void) const;
+    /* Get the number of pixels currently holding samples. */
+  int PendingPixels(void) const;
+
+  /********************************* Mutators *********************************/
+    /*
+     * Size the buffer for a [width] x [height] frame buffer with [samples]
+     * samples (a power of two, up to scmMaxSamples) per pixel, dropping any
+     * pending samples.
+     */
+  void Init(int width, int height, int samples);
+    /*
+     * Set the samples of pixel ([x], [y]) in [mask] to the color [rgb]. If
+     * the pixel held no samples yet, the others start out as its color in
+     * the frame buffer, [pPixel]; if every one of them now holds [rgb], it
+     * is written to [pPixel] instead.
+     */
+  void Cover(int x, int y, unsigned mask, byte *pPixel, const byte rgb[3]);
+    /*
+     * Drop the samples of the [count] pixels of scanline [y] starting at
+     * pixel [x], as they are about to be written whole.
+     */
+  void Drop(int x, int y, int count);
+    /*
+     * Write the average of the samples of each of the [count] pixels of
+     * scanline [y] starting at pixel [x] holding any to its color in the
+     * frame buffer (at [pPixels], three bytes per pixel), and drop them, as
+     * the pixels are about to be blended with.
+     */
+  void ResolvePixels(int x, int y, int count, byte *pPixels);
+    /*
+     * Write the average of the samples of each pixel holding any to the frame
+     * buffer at [pBuffer] (each scanline taking up [stride] bytes), and drop
+     * them all. Returns the number of pixels written.
+     */
+  int Resolve(byte *pBuffer, int stride);
+
+
+/*############################################################################*/
+/*############################## Private Defines #############################*/
+/*############################################################################*/
+private:
+    /*
+     * The samples of a partly covered pixel: those in mMask are mColor and the
+     * rest mBase (colors packed red, green, blue from the low byte up), until
+     * it is expanded to a color per sample, at mOffset in mColors. Expanded
+     * records keep the last color written to them in mColor, and the samples
+     * holding it in mMask.
+     */
+  struct Record
+  {
+      /* The pixel the record belongs to (-1 once dropped). */
+    int      mPixel;
+    unsigned mBase;
+    unsigned mColor;
+    unsigned mMask;
+      /* Index of the record's samples in mColors (-1 while compressed). */
+    int      mOffset;
+  };
+
+
+/*############################################################################*/
+/*############################# Private Methods ##############################*/
+/*############################################################################*/
+private:
+    /* Drop the samples of the [count] pixels starting at pixel [x] of [y]. */
+  void DropRow(int x, int y, int count);
+    /* Drop [record], whose pixel is on scanline [y]. */
+  void DropRecord(Record &record, int y);
+    /* Give [record] a color per sample. */
+  void Expand(Record &record);
+    /* Write the average of the samples of [record] to [pRgb]. */
+  void Average(const Record &record, byte *pRgb) const;
+
+
+/*############################################################################*/
+/*############################# Private Members ##############################*/
+/*############################################################################*/
+private:
+  int                   mWidth;
+  int                   mHeight;
+  int                   mSamples;
+    /* The log base two of mSamples. */
+  int                   mSampleShift;
+    /* The record of each pixel (-1 for none). */
+  std::vector<int>      mRecords;
+    /* Number of live records on each scanline. */
+  std::vector<int>      mRowRecords;
+    /* Every record made since the buffer was last emptied. */
+  std::vector<Record>   mRecordList;
+    /*
+     * The colors (red, green, blue) of the samples of the expanded records,
+     * channel by channel.
+     */
+  std::vector<byte>     mColors;
+    /* Number of live records. */
+  int                   mPending;
+};
+
+
+/*############################################################################*/
+/*########################## Inline Implementations ##########################*/
+/*############################################################################*/
+
+/*!
+******************************************************************************
+  \fn int Samples(void) const
+
+  \brief
+    Get the number of samples per pixel.
+*******************************************************************************/
+inline
+int SampleBuffer::Samples(void) const
+{
+  return mSamples;
+}
+
+/*!
+******************************************************************************
+  \fn unsigned FullMask(void) const
+
+  \brief
+    Get the coverage mask with a bit set for every sample.
+*******************************************************************************/
+inline
+unsigned SampleBuffer::FullMask(void) const
+{
+  return ((1u << mSamples) - 1u);
+}
+
+/*!
+******************************************************************************
+  \fn int PendingPixels(void) const
+
+  \brief
+    Get the number of pixels currently holding samples.
+*******************************************************************************/
+inline
+int SampleBuffer::PendingPixels(void) const
+{
+  return mPending;
+}
+
+/*!
+******************************************************************************
+  \fn void Drop(int x, int y, int count)
+
+  \brief
+    Drop the samples of a run of pixels about to be written whole. Most
+    writes land on scanlines without any samples, which only takes one
+    comparison to find out.
+*******************************************************************************/
+inline
+void SampleBuffer::Drop(int x, int y, int count)
+{
+  if (mRowRecords[y])
+    DropRow(x, y, count);
+}
+
+/*!
+******************************************************************************
+  \fn void ResolvePixels(int x, int y, int count, byte *pPixels)
+
+  \brief
+    Write the average of the samples of a run of pixels about to be blended
+    with to the frame buffer, and drop them.
+*******************************************************************************/
+inline
+void SampleBuffer::ResolvePixels(int x, int y, int count, byte *pPixels)
+{
+  const int *pRecord = &mRecords[(y * mWidth) + x];
+  for (int i = 0; (i < count) && mRowRecords[y]; ++i)
+    if (0 <= pRecord[i])
+    {
+      Average(mRecordList[pRecord[i]], (pPixels + (3 * i)));
+      DropRecord(mRecordList[pRecord[i]], y);
+    }
+}
+
+
+#endif
@@ -0,0 +1,129 @@
+/*!
+*****************************************************************************
+\file   SceneGraph.cpp
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the implementation of the SceneGraph class' methods.
+*******************************************************************************/
+#include "SceneGraph.h"
+#include <algorithm>
+#include <cassert>
+
+
+/*############################################################################*/
+/*############################# Static Members ###############################*/
+/*############################################################################*/
+
+  /* Parent of the root nodes (defined here since it is bound to references). */
+const SceneGraph::NodeId SceneGraph::scmNoParent;
+
+
+/*############################################################################*/
+/*############################## Public Methods ##############################*/
+/*############################################################################*/
+
+  /* Default Constructor. */
+SceneGraph::SceneGraph(void)
+  : mParents(),
+    mLocals(),
+    mWorlds(),
+    mDirty() { ; }
+
+  /* Get the number of nodes in the graph. */
+int SceneGraph::NodeCount(void) const
+{ return static_cast<int>(mParents.size()); }
+
+  /* Get the parent of [node]. */
+SceneGraph::NodeId SceneGraph::GetParent(NodeId node) const
+{ return mParents[node]; }
+
+  /* Get the local transformation of [node]. */
+const Affine2x3 &SceneGraph::GetLocal(NodeId node) const
+{ return mLocals[node]; }
+
+  /* Get the world transformation of [node] as of the last Update(). */
+const Affine2x3 &SceneGraph::GetWorld(NodeId node) const
+{ return mWorlds[node]; }
+
+  /* Set the local transformation of [node] and mark it dirty. */
+void SceneGraph::SetLocal(NodeId node, const Affine2x3 &local)
+{
+  mLocals[node] = local;
+  mDirty[node]  = 1;
+}
+
+  /* Remove every node. */
+void SceneGraph::Clear(void)
+{
+  mParents.clear();
+  mLocals.clear();
+  mWorlds.clear();
+  mDirty.clear();
+}
+
+  /* Append a node under [parent] and return its id. */
+SceneGraph::NodeId SceneGraph::AddNode(NodeId parent, const Affine2x3 &local)
+{
+  NodeId node = NodeCount();
+
+  Resize(node + 1);
+  InitNode(node, parent, local);
+
+  return node;
+}
+
+  /* Grow the graph to [count] nodes. */
+void SceneGraph::Resize(int count)
+{
+  mParents.resize(count, scmNoParent);
+  mLocals.resize(count);
+  mWorlds.resize(count);
+  mDirty.resize(count, 1);
+}
+
+  /* (Re)initialize [node] as a child of [parent]. */
+void SceneGraph::InitNode(NodeId node, NodeId parent, const Affine2x3 &local)
+{
+    /* Parents must come first so Update() can work in a single pass. */
+  assert(parent < node);
+
+  mParents[node] = parent;
+  SetLocal(node, local);
+}
+
+  /* Recompute the world transformation of dirty nodes and their descendants. */
+int SceneGraph::Update(void)
+{
+  const int count      = NodeCount();
+  int       recomputed = 0;
+
+    /*
+     * Parents precede their children, so by the time a node is visited its
+     * parent's flag already says whether the parent's world changed.
+     */
+  for (int i = 0; i < count; ++i)
+  {
+    const NodeId parent = mParents[i];
+
+    if ((parent != scmNoParent) && mDirty[parent])
+      mDirty[i] = 1;
+    if (!mDirty[i])
+      continue;
+
+    mWorlds[i] = ((parent == scmNoParent) ? mLocals[i]
+                                          : (mWorlds[parent] * mLocals[i]));
+    ++recomputed;
+  }
+
+    /* Every world transformation is now up to date. */
+  if (recomputed)
+    std::fill(mDirty.begin(), mDirty.end(), 0);
+
+  return recomputed;
+}
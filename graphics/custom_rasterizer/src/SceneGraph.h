@@ -0,0 +1,117 @@
+/*!
+*****************************************************************************
+\file   SceneGraph.h
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the definition of the SceneGraph class, which stores a
+  hierarchy of local transformations and lazily computes their
+  object-to-world transformations.
+*******************************************************************************/
+#ifndef SCENEGRAPH_H
+#define SCENEGRAPH_H
+
+#include "Affine2x3.h"
+#include <vector>
+
+
+/*!
+******************************************************************************
+  \class SceneGraph
+
+  \brief
+    A flattened hierarchy of transformation nodes. Every node stores a local
+    transformation (relative to its parent) and a cached world transformation.
+    Nodes are stored in parallel arrays in index order, and a node's parent
+    must always have a lower index than the node itself, so a single forward
+    pass over the arrays visits every parent before its children.
+
+    Setting a node's local transformation marks it dirty. Update() then
+    recomputes the world transformation of dirty nodes and their descendants
+    only; unchanged subtrees keep their cached world transformations.
+*******************************************************************************/
+class SceneGraph
+{
+/*############################################################################*/
+/*############################## Public Defines ##############################*/
+/*############################################################################*/
+public:
+  typedef int NodeId;
+
+  /*############################### Constants ################################*/
+  static const NodeId scmNoParent = -1; /* Parent of the root nodes.          */
+
+
+/*############################################################################*/
+/*############################## Public Methods ##############################*/
+/*############################################################################*/
+public:
+
+  /******************************* Constructors *******************************/
+    /* Default Constructor. */
+  SceneGraph(void);
+
+  /********************************* Getters **********************************/
+    /* Get the number of nodes in the graph. */
+  int NodeCount(void) const;
+    /* Get the parent of [node] (scmNoParent for root nodes). */
+  NodeId GetParent(NodeId node) const;
+    /* Get the local transformation of [node]. */
+  const Affine2x3 &GetLocal(NodeId node) const;
+    /* Get the world transformation of [node] as of the last Update(). */
+  const Affine2x3 &GetWorld(NodeId node) const;
+
+  /********************************* Setters **********************************/
+    /*
+     * Set the local transformation of [node] and mark it dirty. Different
+     * nodes may be set from different threads at the same time.
+     */
+  void SetLocal(NodeId node, const Affine2x3 &local);
+
+  /********************************* Mutators *********************************/
+    /* Remove every node. */
+  void Clear(void);
+    /* Append a node under [parent] and return its id. */
+  NodeId AddNode(NodeId parent, const Affine2x3 &local = Affine2x3());
+    /*
+     * Grow the graph to [count] nodes. The new nodes are roots with identity
+     * transformations until they are set up with InitNode(), which allows
+     * large graphs to be built in parallel.
+     */
+  void Resize(int count);
+    /* (Re)initialize [node] as a child of [parent] (which must be < node). */
+  void InitNode(NodeId node, NodeId parent, const Affine2x3 &local);
+    /*
+     * Recompute the world transformation of every dirty node and of every
+     * descendant of a dirty node, then clear the dirty flags. Returns the
+     * number of world transformations that were recomputed.
+     */
+  int Update(void);
+
+
+/*############################################################################*/
+/*############################# Private Members ##############################*/
+/*############################################################################*/
+private:
+    /* The parent of each node. */
+  std::vector<NodeId>        mParents;
+    /* The local (node-to-parent) transformation of each node. */
+  std::vector<Affine2x3>     mLocals;
+    /* The cached world (node-to-world) transformation of each node. */
+  std::vector<Affine2x3>     mWorlds;
+    /*
+     * Whether each node's local transformation changed since the last
+     * Update(). During Update() this also marks nodes whose parent's world
+     * transformation changed.
+     */
+  std::vector<unsigned char> mDirty;
+};
+
+
+#endif
+
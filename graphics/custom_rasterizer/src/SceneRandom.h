@@ -0,0 +1,86 @@
+/*!
+*****************************************************************************
+\file   SceneRandom.h
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the definition of the CounterRng class, a counter-based
+  random number generator used to generate the scene in parallel.
+*******************************************************************************/
+#ifndef SCENERANDOM_H
+#define SCENERANDOM_H
+
+#include <cstdint>
+
+
+/*!
+******************************************************************************
+  \class CounterRng
+
+  \brief
+    Stateless-style random number generator: the n_th number of a stream is a
+    hash of (seed, stream, n), so any object can generate its own values from
+    its index without touching shared state. This makes scene generation
+    reproducible from a seed no matter how many threads generate it, or in
+    which order the objects are visited.
+*******************************************************************************/
+class CounterRng
+{
+/*############################################################################*/
+/*############################## Public Methods ##############################*/
+/*############################################################################*/
+public:
+
+  /******************************* Constructors *******************************/
+    /* Non-Default Constructor. Selects stream [stream] of seed [seed]. */
+  CounterRng(std::uint64_t seed, std::uint64_t stream)
+    : mKey(Mix(seed ^ (stream * 0x9E3779B97F4A7C15ull))),
+      mCounter(0) { ; }
+
+  /********************************* Mutators *********************************/
+    /* Get the next 32 random bits of this stream. */
+  std::uint32_t Next(void)
+  { return static_cast<std::uint32_t>(Mix(mKey + (++mCounter * 0xD1B54A32D192ED03ull)) >> 32); }
+    /* Get a random float in the range [a, b]. */
+  float Float(float a = 0.0f, float b = 1.0f)
+  {
+      /* Use the top 24 bits so every value is exactly representable. */
+    return (a + ((b - a) * (static_cast<float>(Next() >> 8) *
+                            (1.0f / 16777215.0f))));
+  }
+    /* Get a random int in the range [a, b]. */
+  int Int(int a, int b)
+  { return (a + static_cast<int>(Next() % static_cast<std::uint32_t>(b - a + 1))); }
+
+
+/*############################################################################*/
+/*############################# Private Methods ##############################*/
+/*############################################################################*/
+private:
+    /* SplitMix64 finalizer: a fast, well distributed 64-bit hash. */
+  static std::uint64_t Mix(std::uint64_t z)
+  {
+    z = ((z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull);
+    z = ((z ^ (z >> 27)) * 0x94D049BB133111EBull);
+    return (z ^ (z >> 31));
+  }
+
+
+/*############################################################################*/
+/*############################# Private Members ##############################*/
+/*############################################################################*/
+private:
+    /* The hashed (seed, stream) pair. */
+  std::uint64_t mKey;
+    /* The number of values drawn from this stream so far. */
+  std::uint64_t mCounter;
+};
+
+
+#endif
+
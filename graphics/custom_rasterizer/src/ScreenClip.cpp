@@ -0,0 +1,121 @@
+/*!
+*****************************************************************************
+\file   ScreenClip.cpp
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the implementation of ScreenClip and RectClip.
+*******************************************************************************/
+#include "ScreenClip.h"
+
+
+/*############################################################################*/
+/*############################### Global Data ################################*/
+/*############################################################################*/
+
+  /* Clip object for the current screen size. */
+static Clip sScreenClip;
+  /* The screen size [sScreenClip] was built for. */
+static int  sScreenW = -1;
+static int  sScreenH = -1;
+
+
+/*############################################################################*/
+/*######################### Function Implementation ##########################*/
+/*############################################################################*/
+
+/*!
+******************************************************************************
+  \fn Clip &ScreenClip(int width, int height)
+
+  \brief
+    Get a Clip object that clips to the screen, rebuilding it if the screen
+    dimensions changed.
+
+  \param width
+    The width of the screen.
+
+  \param height
+    The height of the screen.
+
+  \return
+    A reference to the Clip object.
+*******************************************************************************/
+Clip &ScreenClip(int width, int height)
+{
+  if ((width != sScreenW) || (height != sScreenH))
+  {
+    float borderedWidth  = (width  - 1.0f);
+    float borderedHeight = (height - 1.0f);
+    Point screenVerts[4] = { Point(         0.0f,           0.0f),
+                             Point(         0.0f, borderedHeight),
+                             Point(borderedWidth, borderedHeight),
+                             Point(borderedWidth,           0.0f)
+                           };
+
+    sScreenClip = Clip(4, screenVerts);
+    sScreenW    = width;
+    sScreenH    = height;
+  }
+
+  return sScreenClip;
+}
+
+/*!
+******************************************************************************
+  \fn Clip RectClip(int x0, int y0, int x1, int y1, int width, int height)
+
+  \brief
+    Build a Clip object that clips to the pixel rectangle [x0, x1) x [y0, y1).
+
+    The clip region runs from half a pixel before the first pixel center to
+    (just short of) half a pixel past the last one, so that clipped faces
+    and lines cover the pixels inside the rectangle they would cover if
+    drawn unclipped (up to rounding where a face or line is cut). Sides
+    lying on the border of the screen are pushed out of the way instead,
+    leaving that border to ScreenClip() so it is cut exactly as usual.
+
+  \param x0
+    The left-most column of the rectangle.
+
+  \param y0
+    The first row of the rectangle.
+
+  \param x1
+    One past the right-most column of the rectangle.
+
+  \param y1
+    One past the last row of the rectangle.
+
+  \param width
+    The width of the screen.
+
+  \param height
+    The height of the screen.
+
+  \return
+    The Clip object.
+*******************************************************************************/
+Clip RectClip(int x0, int y0, int x1, int y1, int width, int height)
+{
+    /* Stay clear of the rounding point of the pixel past the rectangle. */
+  const float margin = (0.5f - (1.0f / 64.0f));
+    /* Far enough past the screen that nothing clipped to it is cut. */
+  const float far    = static_cast<float>(2 * (width + height));
+  float left   = ((x0 > 0)      ? (static_cast<float>(x0) - 0.5f)       : -far);
+  float bottom = ((y0 > 0)      ? (static_cast<float>(y0) - 0.5f)       : -far);
+  float right  = ((x1 < width)  ? (static_cast<float>(x1 - 1) + margin) :  far);
+  float top    = ((y1 < height) ? (static_cast<float>(y1 - 1) + margin) :  far);
+  Point rectVerts[4] = { Point( left, bottom),
+                         Point( left,    top),
+                         Point(right,    top),
+                         Point(right, bottom)
+                       };
+
+  return Clip(4, rectVerts);
+}
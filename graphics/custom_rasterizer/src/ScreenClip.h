@@ -0,0 +1,53 @@
+/*!
+*****************************************************************************
+\file   ScreenClip.h
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the prototypes of ScreenClip, which provides a shared Clip
+  object for clipping to the screen, and RectClip, which clips to a smaller
+  region of it, along with InRect, which tests whether a point needs
+  clipping to a rectangle at all.
+*******************************************************************************/
+#ifndef SCREENCLIP_H
+#define SCREENCLIP_H
+
+#include "Clip.h"
+
+
+/*############################################################################*/
+/*########################### Function Prototypes ############################*/
+/*############################################################################*/
+
+  /*
+   * Get a Clip object that clips to the screen (the rectangle spanning the
+   * pixel centers (0, 0) to (width - 1, height - 1)). The Clip object is only
+   * rebuilt when the screen dimensions change.
+   */
+Clip &ScreenClip(int width, int height);
+  /*
+   * Build a Clip object that clips to the pixel rectangle [x0, x1) x [y0, y1)
+   * of a [width] x [height] screen, so that nothing clipped by it is drawn
+   * outside of those pixels. Sides on the border of the screen do not clip,
+   * so geometry reaching past the screen must go through ScreenClip() too.
+   */
+Clip RectClip(int x0, int y0, int x1, int y1, int width, int height);
+
+
+/*############################################################################*/
+/*############################# Helper Functions #############################*/
+/*############################################################################*/
+
+  /* Whether [P] lies within the rectangle [xMin, xMax] x [yMin, yMax]. */
+inline
+bool InRect(const Point &P, float xMin, float yMin, float xMax, float yMax)
+{ return ((xMin <= P.x) && (P.x <= xMax) && (yMin <= P.y) && (P.y <= yMax)); }
+
+
+#endif
+
@@ -0,0 +1,131 @@
+/*!
+*****************************************************************************
+\file   SmoothLine.cpp
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the implementation of DrawSmoothLine.
+
+  The line's position across its minor axis is stepped in fixed point, and
+  its fraction (in 1/256ths) is the weight given to the farther of the two
+  pixels it passes between; blending goes through Raster::BlendPixel(), so
+  no floating point is done per pixel.
+*******************************************************************************/
+#include "SmoothLine.h"
+#include "FixedPoint.h"
+#include <algorithm>
+#include <cmath>
+
+
+/*############################################################################*/
+/*########################## Local Helper Functions ##########################*/
+/*############################################################################*/
+
+  /* Round [f] to the nearest pixel, as DrawLine does. */
+inline
+int RoundToPixel(float f)
+{ return static_cast<int>(std::floor(f + 0.5f)); }
+
+  /* The weight (out of gFullWeight) of the fraction [f] of a pixel. */
+inline
+int ToWeight(double f)
+{ return std::min(std::max(static_cast<int>((f * gFullWeight) + 0.5), 0), gFullWeight); }
+
+  /*
+   * Draw the line from [d0] to [d1] along its major axis (d0 <= d1), passing
+   * [r0] across the minor axis at [d0] and moving [slope] across it per
+   * pixel along it; [xMajor] is set when the major axis is the x-axis.
+   */
+static void DrawMajor(Raster &raster, bool xMajor, float d0, float d1, float r0, double slope)
+{
+  const int first = RoundToPixel(d0);
+  const int last  = RoundToPixel(d1);
+    /* How much of the first/last pixel's step the segment covers. */
+  const int gap0  = ((first == last) ? ToWeight(static_cast<double>(d1) - d0)
+                                     : ToWeight((first + 0.5) - d0));
+  const int gap1  = ToWeight(d1 - (last - 0.5));
+
+  Fixed r    = ToFixed(r0 + (slope * (first - static_cast<double>(d0))));
+  Fixed step = ToFixed(slope);
+  for (int d = first; d <= last; ++d, r += step)
+  {
+    const int rInt = static_cast<int>(r >> gFracBits);
+      /* The fraction of the way from pixel rInt to pixel rInt + 1. */
+    const int frac = static_cast<int>((r >> (gFracBits - 8)) & 255);
+    int       upper = frac;
+    int       lower = (gFullWeight - frac);
+    if ((d == first) || (d == last))
+    {
+      const int gap = ((d == first) ? gap0 : gap1);
+      upper = ((upper * gap) >> 8);
+      lower = ((lower * gap) >> 8);
+    }
+
+    if (xMajor)
+      raster.GotoPoint(d, rInt);
+    else
+      raster.GotoPoint(rInt, d);
+    raster.BlendPixel(lower);
+    if (xMajor)
+      raster.GotoPoint(d, (rInt + 1));
+    else
+      raster.GotoPoint((rInt + 1), d);
+    raster.BlendPixel(upper);
+  }
+}
+
+
+/*############################################################################*/
+/*######################### Function Implementation ##########################*/
+/*############################################################################*/
+
+/*!
+******************************************************************************
+  \fn void DrawSmoothLine(Raster &raster, const Point &pt_P,
+                          const Point &pt_Q)
+
+  \brief
+    Draw an anti-aliased line segment.
+
+  \param raster
+    The Raster object that the line will be drawn to.
+
+  \param pt_P
+    The start point of the line (in screen coordinates).
+
+  \param pt_Q
+    The end point of the line (in screen coordinates).
+*******************************************************************************/
+void DrawSmoothLine(Raster &raster, const Point &pt_P, const Point &pt_Q)
+{
+  const double dx = (static_cast<double>(pt_Q.x) - pt_P.x);
+  const double dy = (static_cast<double>(pt_Q.y) - pt_P.y);
+
+    /* A segment with no length is a single pixel, as DrawLine draws it. */
+  if ((dx == 0.0) && (dy == 0.0))
+  {
+    raster.GotoPoint(RoundToPixel(pt_P.x), RoundToPixel(pt_P.y));
+    raster.BlendPixel(gFullWeight);
+    return;
+  }
+
+  if (std::fabs(dy) <= std::fabs(dx))
+  {
+    if (pt_P.x < pt_Q.x)
+      DrawMajor(raster, true, pt_P.x, pt_Q.x, pt_P.y, (dy / dx));
+    else
+      DrawMajor(raster, true, pt_Q.x, pt_P.x, pt_Q.y, (dy / dx));
+  }
+  else
+  {
+    if (pt_P.y < pt_Q.y)
+      DrawMajor(raster, false, pt_P.y, pt_Q.y, pt_P.x, (dx / dy));
+    else
+      DrawMajor(raster, false, pt_Q.y, pt_P.y, pt_Q.x, (dx / dy));
+  }
+}
@@ -0,0 +1,39 @@
+/*!
+*****************************************************************************
+\file   SmoothLine.h
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the prototype of DrawSmoothLine, which draws
+  anti-aliased lines.
+*******************************************************************************/
+#ifndef SMOOTHLINE_H
+#define SMOOTHLINE_H
+
+#include "Affine.h"
+#include "Raster.h"
+
+
+/*############################################################################*/
+/*########################### Function Prototypes ############################*/
+/*############################################################################*/
+
+  /*
+   * Draw the line segment from [pt_P] to [pt_Q] (in screen coordinates,
+   * already clipped to the screen) to the Raster object's pixel buffer in
+   * the current foreground color, anti-aliased: the line steps along its
+   * major axis like DrawLine, but each step blends it into the two pixels
+   * straddling it across the minor axis, weighted by how close it passes to
+   * each (Wu's algorithm). The end pixels are weighted by how much of their
+   * step the segment covers, so segments meeting end to end add up to a
+   * whole pixel where they meet.
+   */
+void DrawSmoothLine(Raster &raster, const Point &pt_P, const Point &pt_Q);
+
+
+#endif
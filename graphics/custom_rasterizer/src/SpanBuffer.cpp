@@ -0,0 +1,189 @@
+/*!
+*****************************************************************************
+\file   SpanBuffer.cpp
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the implementation of the SpanBuffer class' methods.
+*******************************************************************************/
+#include "SpanBuffer.h"
+#include <algorithm>
+
+
+/*############################################################################*/
+/*############################## Public Methods ##############################*/
+/*############################################################################*/
+
+  /* Default Constructor. */
+SpanBuffer::SpanBuffer(void)
+  : mRows(),
+    mFree(),
+    mHintY(-1),
+    mHintRun(0),
+    mRequested(0),
+    mWritten(0) { ; }
+
+  /* Whether every pixel of the rectangle is already covered. */
+bool SpanBuffer::Covers(int x0, int y0, int x1, int y1) const
+{
+  y0 = std::max(y0, 0);
+  y1 = std::min(y1, static_cast<int>(mRows.size()));
+  for (int y = y0; y < y1; ++y)
+  {
+    const std::vector<Span> &row = mRows[y];
+      /* Runs never touch, so the rectangle has to lie within a single one. */
+    auto iter = std::upper_bound(row.begin(), row.end(), x0,
+                                 [] (int x, const Span &span)
+                                 { return (x < span.mX1); });
+    if ((iter == row.end()) || (x0 < iter->mX0) || (iter->mX1 < x1))
+      return false;
+  }
+
+  return true;
+}
+
+  /* Number of pixels asked for since the last Reset(). */
+int SpanBuffer::RequestedPixels(void) const
+{ return mRequested; }
+
+  /* Number of those pixels that were still free. */
+int SpanBuffer::WrittenPixels(void) const
+{ return mWritten; }
+
+  /* Mark every pixel as free. */
+void SpanBuffer::Reset(int height)
+{
+    /* Keep each scanline's storage around for the next frame. */
+  mRows.resize(height);
+  for (auto iter = mRows.begin(); iter != mRows.end(); ++iter)
+    iter->clear();
+  mHintY     = -1;
+  mRequested = 0;
+  mWritten   = 0;
+}
+
+  /* Claim a single pixel. */
+bool SpanBuffer::Claim(int x, int y)
+{
+  std::vector<Span> &row = mRows[y];
+
+  ++mRequested;
+    /*
+     * Pixels are mostly written left to right along a scanline, so first try
+     * the run the last pixel landed in: either it (or the one after it)
+     * already covers this pixel, or it ends right before it and just grows.
+     */
+  if (y == mHintY)
+  {
+    Span              &run  = row[mHintRun];
+    const std::size_t  next = (mHintRun + 1);
+
+    if ((run.mX0 <= x) && (x < run.mX1))
+      return false;
+    if (run.mX1 == x)
+    {
+      if ((next < row.size()) && (row[next].mX0 == x))
+      {
+        mHintRun = next;
+        return false;
+      }
+      if ((next < row.size()) && (row[next].mX0 == (x + 1)))
+      {
+        run.mX1 = row[next].mX1;
+        row.erase(row.begin() + next);
+      }
+      else
+        run.mX1 = (x + 1);
+      ++mWritten;
+      return true;
+    }
+  }
+
+  auto pos = FindRun(row, x);
+  mHintY   = y;
+  if ((pos != row.end()) && (pos->mX0 <= x))
+  {
+    mHintRun = static_cast<std::size_t>(pos - row.begin());
+    return false;
+  }
+
+  mHintRun = Insert(row, pos, x, (x + 1));
+  ++mWritten;
+  return true;
+}
+
+  /* Claim a run of pixels of one scanline. */
+const std::vector<SpanBuffer::Span> &SpanBuffer::ClaimSpan(int y, int x0, int x1)
+{
+  mFree.clear();
+  if (x1 <= x0)
+    return mFree;
+  mRequested += (x1 - x0);
+
+    /* Collect the gaps between the covered runs overlapping [x0, x1). */
+  std::vector<Span> &row  = mRows[y];
+  auto               iter = FindRun(row, x0);
+  for (int x = x0; x < x1; )
+  {
+    if ((iter != row.end()) && (iter->mX0 <= x))
+    {
+      x = (iter++)->mX1;
+      continue;
+    }
+
+    const int end = (((iter != row.end()) && (iter->mX0 < x1)) ? iter->mX0 : x1);
+    mFree.push_back(Span(x, end));
+    x = end;
+  }
+
+    /* Then cover them. */
+  mHintY = -1;
+  for (auto run = mFree.begin(); run != mFree.end(); ++run)
+  {
+    Insert(row, FindRun(row, run->mX0), run->mX0, run->mX1);
+    mWritten += (run->mX1 - run->mX0);
+  }
+
+  return mFree;
+}
+
+
+/*############################################################################*/
+/*############################# Private Methods ##############################*/
+/*############################################################################*/
+
+  /* Mark a free run of pixels as covered. */
+std::size_t SpanBuffer::Insert(std::vector<Span> &row, std::vector<Span>::iterator pos, int x0, int x1)
+{
+  const std::size_t index = static_cast<std::size_t>(pos - row.begin());
+  const bool joinsLeft  = ((pos != row.begin()) && ((pos - 1)->mX1 == x0));
+  const bool joinsRight = ((pos != row.end())   && (pos->mX0 == x1));
+
+    /* Grow the neighboring runs rather than adding a new one where possible. */
+  if (joinsLeft && joinsRight)
+  {
+    (pos - 1)->mX1 = pos->mX1;
+    row.erase(pos);
+  }
+  else if (joinsLeft)
+    (pos - 1)->mX1 = x1;
+  else if (joinsRight)
+    pos->mX0 = x0;
+  else
+    row.insert(pos, Span(x0, x1));
+
+  return (joinsLeft ? (index - 1) : index);
+}
+
+  /* Find the first run that ends after pixel [x]. */
+std::vector<SpanBuffer::Span>::iterator SpanBuffer::FindRun(std::vector<Span> &row, int x)
+{
+  return std::upper_bound(row.begin(), row.end(), x,
+                          [] (int value, const Span &span)
+                          { return (value < span.mX1); });
+}
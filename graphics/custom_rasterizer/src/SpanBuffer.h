@@ -0,0 +1,123 @@
+/*!
+*****************************************************************************
+\file   SpanBuffer.h
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the definition of the SpanBuffer class, which records
+  the pixels of each scanline that have already been drawn so that opaque
+  geometry can be drawn front to back, each pixel being written only once.
+*******************************************************************************/
+#ifndef SPANBUFFER_H
+#define SPANBUFFER_H
+
+#include <cstddef>
+#include <vector>
+
+
+/*!
+******************************************************************************
+  \class SpanBuffer
+
+  \brief
+    An S-buffer: for every scanline, the sorted list of disjoint runs of
+    pixels ([mX0, mX1)) that are already covered. Claiming a pixel (or a run
+    of pixels) marks it as covered and reports whether (or which parts of
+    it) were still free, so drawing opaque geometry nearest first and only
+    writing what is claimed yields the same frame as painting it back to
+    front, minus the overdraw. Neighboring runs are merged as they grow, so
+    a scanline that is fully drawn holds a single run and is skipped with
+    one comparison.
+
+    The buffer also counts the pixels that were asked for and the pixels
+    that were actually free: the first is what painting the same geometry
+    back to front would have written.
+*******************************************************************************/
+class SpanBuffer
+{
+/*############################################################################*/
+/*############################## Public Defines ##############################*/
+/*############################################################################*/
+public:
+    /* A run of pixels, [mX0, mX1), of one scanline. */
+  struct Span
+  {
+    int mX0;
+    int mX1;
+
+      /* Default constructor. */
+    Span(int x0 = 0, int x1 = 0) : mX0(x0), mX1(x1) { ; }
+  };
+
+
+/*############################################################################*/
+/*############################## Public Methods ##############################*/
+/*############################################################################*/
+public:
+
+  /******************************* Constructors *******************************/
+    /* Default Constructor. */
+  SpanBuffer(void);
+
+  /********************************* Getters **********************************/
+    /* Whether every pixel of [x0, x1) x [y0, y1) is already covered. */
+  bool Covers(int x0, int y0, int x1, int y1) const;
+    /* Number of pixels asked for since the last Reset(). */
+  int RequestedPixels(void) const;
+    /* Number of those pixels that were still free (and so were written). */
+  int WrittenPixels(void) const;
+
+  /********************************* Mutators *********************************/
+    /* Mark every pixel of a screen [height] scanlines tall as free. */
+  void Reset(int height);
+    /*
+     * Claim pixel ([x], [y]), returning whether it was still free (and so
+     * should be written).
+     */
+  bool Claim(int x, int y);
+    /*
+     * Claim the pixels [x0, x1) of scanline [y], returning the runs of them
+     * that were still free (and so should be written). The returned list is
+     * only valid until the next call.
+     */
+  const std::vector<Span> &ClaimSpan(int y, int x0, int x1);
+
+
+/*############################################################################*/
+/*############################# Private Methods ##############################*/
+/*############################################################################*/
+private:
+    /*
+     * Mark [x0, x1) of [row] as covered, given that none of it was and that
+     * [pos] is the first run of [row] to its right. Returns the index of the
+     * run that now holds it.
+     */
+  static std::size_t Insert(std::vector<Span> &row, std::vector<Span>::iterator pos, int x0, int x1);
+    /* Find the first run of [row] that ends after pixel [x]. */
+  static std::vector<Span>::iterator FindRun(std::vector<Span> &row, int x);
+
+
+/*############################################################################*/
+/*############################# Private Members ##############################*/
+/*############################################################################*/
+private:
+    /* The covered runs of each scanline, sorted left to right. */
+  std::vector<std::vector<Span> > mRows;
+    /* The free runs found by the last call to ClaimSpan(). */
+  std::vector<Span>               mFree;
+    /* The scanline (-1 if none) and run the last claimed pixel landed in. */
+  int                             mHintY;
+  std::size_t                     mHintRun;
+    /* Pixels asked for/written since the last Reset(). */
+  int                             mRequested;
+  int                             mWritten;
+};
+
+
+#endif
+
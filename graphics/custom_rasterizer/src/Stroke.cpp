@@ -0,0 +1,444 @@
+/*!
+*****************************************************************************
+\file   Stroke.cpp
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the implementation of DrawPolyline and DrawEdgeStrokes.
+
+  A stroke is built out of convex pieces: a rectangle per segment (pushed
+  out past open ends by square caps), and a wedge on the outer side of each
+  join (a triangle for a bevel, a quadrilateral for a miter, a fan of arc
+  points for a round join). Each piece is scanned into spans of the pixel
+  centers it covers, with the same rule FillTriangle follows. The pieces
+  overlap wherever they meet, so the spans of the whole stroke are gathered
+  first, bucketed by scanline, then merged, and only the merged runs are
+  written (with Raster::WriteSpan). Every pixel is written once, however
+  many segments and joins cover it.
+*******************************************************************************/
+#include "Stroke.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+
+/*############################################################################*/
+/*############################# Global Constants #############################*/
+/*############################################################################*/
+
+  /* The most points a round join's wedge (including its vertex) is made of. */
+static const int    gMaxFanPoints = 34;
+  /* How far (in pixels) a round join's chords may stray from the arc. */
+static const double gArcTolerance = 0.25;
+  /* Segments shorter than this (in pixels) are dropped. */
+static const double gMinLength    = 1.0 / 1024.0;
+
+
+/*############################################################################*/
+/*########################## Local Helper Functions ##########################*/
+/*############################################################################*/
+
+  /* A point or direction, in double precision. */
+struct Vec2
+{
+  double x;
+  double y;
+};
+
+  /* A span of pixels [mX0, mX1) of scanline mY. */
+struct StrokeSpan
+{
+  int mY;
+  int mX0;
+  int mX1;
+};
+
+  /* The spans of the stroke being drawn, as scanned and then bucketed by row. */
+static std::vector<StrokeSpan> sSpans;
+static std::vector<StrokeSpan> sRowSpans;
+  /* The index of the first span of each row in sRowSpans (plus one past the end). */
+static std::vector<int>        sRowStarts;
+  /* The points of the polyline being drawn, with repeated points dropped. */
+static std::vector<Vec2>       sPoints;
+
+  /* Point [P] moved by [s] times [d]. */
+inline
+Vec2 Offset(const Vec2 &P, const Vec2 &d, double s)
+{
+  Vec2 R = { (P.x + (s * d.x)), (P.y + (s * d.y)) };
+  return R;
+}
+
+  /*
+   * One side of a convex polygon, walked from its top point to its bottom
+   * one: the edge holding the current scanline (from its upper end point,
+   * included, to its lower one, excluded).
+   */
+struct PolygonSide
+{
+  const Vec2 *mpPoints;
+  int         mCount;
+  int         mStep;
+  int         mTo;
+    /* The current edge's upper end point and its change in x per scanline. */
+  Vec2        mFrom;
+  double      mSlope;
+
+    /* Move down to the edge holding scanline [y], and get its x there. */
+  double CrossingAt(int y)
+  {
+    if (mpPoints[mTo].y <= y)
+    {
+      do
+      {
+        mFrom = mpPoints[mTo];
+        mTo   = ((mTo + mStep + mCount) % mCount);
+      } while (mpPoints[mTo].y <= y);
+      mSlope = ((mpPoints[mTo].x - mFrom.x) / (mpPoints[mTo].y - mFrom.y));
+    }
+    return (mFrom.x + ((y - mFrom.y) * mSlope));
+  }
+};
+
+  /*
+   * Add the spans of the pixel centers inside the convex polygon made of the
+   * [count] points at [pPoints] (in order, either way around) that lie in
+   * [clipRect], walking its two sides down from its top point.
+   */
+static void AddConvexSpans(const Vec2 *pPoints, int count, const DirtyRect &clipRect)
+{
+  int top    = 0;
+  int bottom = 0;
+  for (int i = 1; i < count; ++i)
+  {
+    if (pPoints[i].y < pPoints[top].y)
+      top = i;
+    if (pPoints[bottom].y < pPoints[i].y)
+      bottom = i;
+  }
+  const int y0 = std::max(static_cast<int>(std::ceil(pPoints[top].y)),    clipRect.mY0);
+  const int y1 = std::min(static_cast<int>(std::ceil(pPoints[bottom].y)), clipRect.mY1);
+
+  PolygonSide left  = { pPoints, count, -1, top, pPoints[top], 0.0 };
+  PolygonSide right = { pPoints, count,  1, top, pPoints[top], 0.0 };
+  for (int y = y0; y < y1; ++y)
+  {
+    const double xLeft  = left.CrossingAt(y);
+    const double xRight = right.CrossingAt(y);
+    const StrokeSpan span = { y,
+                              std::max(static_cast<int>(std::ceil(std::min(xLeft, xRight))), clipRect.mX0),
+                              std::min(static_cast<int>(std::ceil(std::max(xLeft, xRight))), clipRect.mX1) };
+    if (span.mX0 < span.mX1)
+      sSpans.push_back(span);
+  }
+}
+
+  /*
+   * Add the rectangle of the segment [P][Q] (along the unit direction [d]),
+   * [half] pixels to either side of it, pushed out past [P] by [ext0] and
+   * past [Q] by [ext1].
+   */
+static void AddSegment(const Vec2 &P, const Vec2 &Q, const Vec2 &d, double half,
+                       double ext0, double ext1, const DirtyRect &clipRect)
+{
+  const Vec2 n     = { -d.y, d.x };
+  const Vec2 P0    = Offset(P, d, -ext0);
+  const Vec2 Q0    = Offset(Q, d,  ext1);
+  const Vec2 quad[4] = { Offset(P0, n,  half), Offset(Q0, n,  half),
+                         Offset(Q0, n, -half), Offset(P0, n, -half) };
+  AddConvexSpans(quad, 4, clipRect);
+}
+
+  /*
+   * Add the wedge filling the outer side of the join at [V] between a
+   * segment along the unit direction [d0] and the next one along [d1].
+   */
+static void AddJoin(const Vec2 &V, const Vec2 &d0, const Vec2 &d1, double half,
+                    const StrokeStyle &style, const DirtyRect &clipRect)
+{
+  const double cross = ((d0.x * d1.y) - (d0.y * d1.x));
+  const double dot   = ((d0.x * d1.x) + (d0.y * d1.y));
+    /* Straight on, the segments' rectangles already meet flush. */
+  if ((std::fabs(cross) < 1e-9) && (0.0 < dot))
+    return;
+
+    /* The outer side is to the right of a left turn, and vice versa. */
+  const double side = ((0.0 < cross) ? -1.0 : 1.0);
+  const Vec2   n0   = { (-d0.y * side), (d0.x * side) };
+  const Vec2   n1   = { (-d1.y * side), (d1.x * side) };
+  const Vec2   A    = Offset(V, n0, half);
+  const Vec2   B    = Offset(V, n1, half);
+
+  if (style.mJoin == StrokeStyle::eMiterJoin)
+  {
+      /* The miter's length over the width is 1 / cos(theta / 2) = 2 / |n0 + n1|. */
+    const Vec2   m    = { (n0.x + n1.x), (n0.y + n1.y) };
+    const double mm   = ((m.x * m.x) + (m.y * m.y));
+    if ((4.0 / style.mMiterLimit / style.mMiterLimit) <= mm)
+    {
+      const Vec2 wedge[4] = { V, A, Offset(V, m, ((2.0 * half) / mm)), B };
+      AddConvexSpans(wedge, 4, clipRect);
+      return;
+    }
+  }
+  else if (style.mJoin == StrokeStyle::eRoundJoin)
+  {
+      /* Step around the arc in chords that stay close enough to it. */
+    const double angle = std::atan2(std::fabs(cross), dot);
+    const double step  = ((half <= gArcTolerance) ? angle
+                                                  : (2.0 * std::acos(1.0 - (gArcTolerance / half))));
+    const int    cuts  = std::max(std::min(static_cast<int>(std::ceil(angle / step)),
+                                           (gMaxFanPoints - 2)), 1);
+    Vec2         fan[gMaxFanPoints];
+    fan[0] = V;
+    for (int i = 0; i <= cuts; ++i)
+    {
+      const double t = ((-side * angle * i) / cuts);
+      const Vec2   r = { ((n0.x * std::cos(t)) - (n0.y * std::sin(t))),
+                         ((n0.x * std::sin(t)) + (n0.y * std::cos(t))) };
+      fan[i + 1] = Offset(V, r, half);
+    }
+    AddConvexSpans(fan, (cuts + 2), clipRect);
+    return;
+  }
+
+  const Vec2 wedge[3] = { V, A, B };
+  AddConvexSpans(wedge, 3, clipRect);
+}
+
+  /* Add the pieces of the polyline through sPoints. */
+static void AddPolyline(bool closed, const StrokeStyle &style, const DirtyRect &clipRect)
+{
+  const int    count = static_cast<int>(sPoints.size());
+  const double half  = (0.5 * style.mWidth);
+  const double cap   = ((style.mCap == StrokeStyle::eSquareCap) ? half : 0.0);
+  if (count < 2)
+  {
+      /* A lone point only shows up as a square cap. */
+    if (count && cap)
+    {
+      const Vec2 d = { 1.0, 0.0 };
+      AddSegment(sPoints[0], sPoints[0], d, half, cap, cap, clipRect);
+    }
+    return;
+  }
+
+  const int segments = (closed ? count : (count - 1));
+  for (int i = 0; i < segments; ++i)
+  {
+    const Vec2  &P   = sPoints[i];
+    const Vec2  &Q   = sPoints[(i + 1) % count];
+    const double len = std::hypot((Q.x - P.x), (Q.y - P.y));
+    const Vec2   d   = { ((Q.x - P.x) / len), ((Q.y - P.y) / len) };
+    AddSegment(P, Q, d, half,
+               ((!closed && (i == 0))              ? cap : 0.0),
+               ((!closed && (i == (segments - 1))) ? cap : 0.0),
+               clipRect);
+
+      /* Join this segment to the next one. */
+    if (closed || (i < (segments - 1)))
+    {
+      const Vec2  &R    = sPoints[(i + 2) % count];
+      const double len1 = std::hypot((R.x - Q.x), (R.y - Q.y));
+      const Vec2   d1   = { ((R.x - Q.x) / len1), ((R.y - Q.y) / len1) };
+      AddJoin(Q, d, d1, half, style, clipRect);
+    }
+  }
+}
+
+  /* Add [P] to sPoints, unless it repeats the last point. */
+static void PushPoint(const Point &P)
+{
+  const Vec2 V = { static_cast<double>(P.x), static_cast<double>(P.y) };
+  if (!sPoints.empty() &&
+      (std::hypot((V.x - sPoints.back().x), (V.y - sPoints.back().y)) < gMinLength))
+    return;
+  sPoints.push_back(V);
+}
+
+  /*
+   * Close sPoints (dropping its last point when it repeats the first one)
+   * and add its pieces.
+   */
+static void FlushPolyline(bool closed, const StrokeStyle &style, const DirtyRect &clipRect)
+{
+  if (closed && (2 < sPoints.size()) &&
+      (std::hypot((sPoints.back().x - sPoints.front().x),
+                  (sPoints.back().y - sPoints.front().y)) < gMinLength))
+    sPoints.pop_back();
+  else
+    closed = false;
+  AddPolyline(closed, style, clipRect);
+  sPoints.clear();
+}
+
+  /* Merge the spans gathered so far, write them, and start over. */
+static void WriteSpans(Raster &raster)
+{
+  if (sSpans.empty())
+    return;
+
+    /* Bucket the spans by scanline (their rows are few and close together). */
+  int yMin = sSpans[0].mY;
+  int yMax = sSpans[0].mY;
+  for (auto iter = sSpans.begin(); iter != sSpans.end(); ++iter)
+  {
+    yMin = std::min(yMin, iter->mY);
+    yMax = std::max(yMax, iter->mY);
+  }
+  sRowStarts.assign((yMax - yMin + 2), 0);
+  for (auto iter = sSpans.begin(); iter != sSpans.end(); ++iter)
+    ++sRowStarts[iter->mY - yMin + 1];
+  for (std::size_t row = 1; row < sRowStarts.size(); ++row)
+    sRowStarts[row] += sRowStarts[row - 1];
+  sRowSpans.resize(sSpans.size());
+  for (auto iter = sSpans.begin(); iter != sSpans.end(); ++iter)
+    sRowSpans[sRowStarts[iter->mY - yMin]++] = *iter;
+
+    /*
+     * Each row's spans now end at its start; sort them (a row only holds a
+     * few, so by insertion), then merge and write them.
+     */
+  int begin = 0;
+  for (int row = 0; row <= (yMax - yMin); ++row)
+  {
+    const int end = sRowStarts[row];
+    for (int i = (begin + 1); i < end; ++i)
+    {
+      const StrokeSpan span = sRowSpans[i];
+      int              j    = i;
+      for (/* j = i */; (begin < j) && (span.mX0 < sRowSpans[j - 1].mX0); --j)
+        sRowSpans[j] = sRowSpans[j - 1];
+      sRowSpans[j] = span;
+    }
+    for (int i = begin; i < end; /* i = i */)
+    {
+      int x0 = sRowSpans[i].mX0;
+      int x1 = sRowSpans[i].mX1;
+      for (++i; (i < end) && (sRowSpans[i].mX0 <= x1); ++i)
+        x1 = std::max(x1, sRowSpans[i].mX1);
+      raster.GotoPoint(x0, (yMin + row));
+      raster.WriteSpan(x1 - x0);
+    }
+    begin = end;
+  }
+  sSpans.clear();
+}
+
+
+/*############################################################################*/
+/*######################### Function Implementation ##########################*/
+/*############################################################################*/
+
+/*!
+******************************************************************************
+  \fn void DrawPolyline(Raster &raster, const Point *pPoints, int count,
+                        bool closed, const StrokeStyle &style,
+                        const DirtyRect &clipRect)
+
+  \brief
+    Draw a wide polyline, writing each pixel it covers once.
+
+  \param raster
+    The Raster object that the polyline will be drawn to.
+
+  \param pPoints
+    The points of the polyline, in device coordinates.
+
+  \param count
+    The number of points.
+
+  \param closed
+    Whether the polyline closes back to its first point.
+
+  \param style
+    The width, joins and caps of the polyline.
+
+  \param clipRect
+    The pixels that may be drawn to.
+*******************************************************************************/
+void DrawPolyline(      Raster      &raster,
+                  const Point       *pPoints,
+                        int          count,
+                        bool         closed,
+                  const StrokeStyle &style,
+                  const DirtyRect   &clipRect)
+{
+  if (!(0.0f < style.mWidth))
+    return;
+
+  sSpans.clear();
+  sPoints.clear();
+  for (int i = 0; i < count; ++i)
+    PushPoint(pPoints[i]);
+  if (closed && count)
+    PushPoint(pPoints[0]);
+  FlushPolyline(closed, style, clipRect);
+  WriteSpans(raster);
+}
+
+/*!
+******************************************************************************
+  \fn void DrawEdgeStrokes(Raster &raster, const Point *pVerts,
+                           const int *pEdges, int edgeCount,
+                           const StrokeStyle &style,
+                           const DirtyRect &clipRect)
+
+  \brief
+    Draw the edges of a mesh as wide polylines, writing each pixel they
+    cover once.
+
+  \param raster
+    The Raster object that the edges will be drawn to.
+
+  \param pVerts
+    The mesh's vertices, in device coordinates.
+
+  \param pEdges
+    The indices of the end points of each edge.
+
+  \param edgeCount
+    The number of edges.
+
+  \param style
+    The width, joins and caps of the edges.
+
+  \param clipRect
+    The pixels that may be drawn to.
+*******************************************************************************/
+void DrawEdgeStrokes(      Raster      &raster,
+                     const Point       *pVerts,
+                     const int         *pEdges,
+                           int          edgeCount,
+                     const StrokeStyle &style,
+                     const DirtyRect   &clipRect)
+{
+  if (!(0.0f < style.mWidth))
+    return;
+
+  sSpans.clear();
+  sPoints.clear();
+  int first = -1;
+  int last  = -1;
+  for (int e = 0; e < edgeCount; ++e, pEdges += 2)
+  {
+      /* An edge not starting where the last one ended starts a new polyline. */
+    if (pEdges[0] != last)
+    {
+      if (0 <= last)
+        FlushPolyline((last == first), style, clipRect);
+      first = pEdges[0];
+      PushPoint(pVerts[first]);
+    }
+    last = pEdges[1];
+    PushPoint(pVerts[last]);
+  }
+  if (0 <= last)
+    FlushPolyline((last == first), style, clipRect);
+  WriteSpans(raster);
+}
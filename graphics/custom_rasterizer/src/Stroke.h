@@ -0,0 +1,112 @@
+/*!
+*****************************************************************************
+\file   Stroke.h
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the definition of the StrokeStyle struct and the
+  prototypes of the functions that draw wide lines and polylines with it.
+*******************************************************************************/
+#ifndef STROKE_H
+#define STROKE_H
+
+#include "Affine.h"
+#include "DamageTracker.h"
+#include "Raster.h"
+#include <algorithm>
+
+
+/*!
+******************************************************************************
+  \struct StrokeStyle
+
+  \brief
+    How wide lines are drawn: their width, how consecutive segments of a
+    polyline are joined, and how the ends of open polylines are capped.
+*******************************************************************************/
+struct StrokeStyle
+{
+    /* The ways segments meet at a vertex. */
+  enum LineJoin
+  {
+    eMiterJoin,  /* Extend the outer edges until they meet.               */
+    eBevelJoin,  /* Cut the corner off between the outer edges.           */
+    eRoundJoin   /* Round the corner off, centered on the vertex.         */
+  };
+    /* The ways the ends of an open polyline are drawn. */
+  enum LineCap
+  {
+    eButtCap,    /* End flush with the end point.                         */
+    eSquareCap   /* Extend past the end point by half the width.          */
+  };
+
+    /* The width (in pixels) of the lines. */
+  float    mWidth;
+  LineJoin mJoin;
+  LineCap  mCap;
+    /*
+     * The longest a miter may get, as a multiple of the width, before the
+     * join is beveled instead.
+     */
+  float    mMiterLimit;
+
+    /* Default constructor. */
+  StrokeStyle(float width = 1.0f, LineJoin join = eMiterJoin, LineCap cap = eButtCap,
+              float miterLimit = 4.0f)
+    : mWidth(width), mJoin(join), mCap(cap), mMiterLimit(miterLimit) { ; }
+};
+
+
+/*############################################################################*/
+/*############################# Helper Functions #############################*/
+/*############################################################################*/
+
+  /*
+   * How far (in pixels) lines drawn in [style] may reach past the points they
+   * are drawn through: half the width, stretched by miters and square caps.
+   */
+inline
+float StrokeReach(const StrokeStyle &style)
+{
+  const float stretch = ((style.mJoin == StrokeStyle::eMiterJoin) ? style.mMiterLimit : 1.0f);
+  return (0.5f * style.mWidth * std::max(stretch, 1.5f));
+}
+
+
+/*############################################################################*/
+/*########################### Function Prototypes ############################*/
+/*############################################################################*/
+
+  /*
+   * Draw the polyline through the [count] points at [pPoints] (in device
+   * coordinates), closed back to the first point when [closed], in the
+   * current foreground color and [style]. Only the pixels in [clipRect] are
+   * written, each of them once.
+   */
+void DrawPolyline(      Raster      &raster,
+                  const Point       *pPoints,
+                        int          count,
+                        bool         closed,
+                  const StrokeStyle &style,
+                  const DirtyRect   &clipRect);
+  /*
+   * Draw the [edgeCount] edges at [pEdges] (pairs of indices into [pVerts],
+   * in device coordinates) in the current foreground color and [style].
+   * Consecutive edges sharing an end point are joined into polylines (closed
+   * when they end where they started), and every pixel in [clipRect] that
+   * any of them covers is written once.
+   */
+void DrawEdgeStrokes(      Raster      &raster,
+                     const Point       *pVerts,
+                     const int         *pEdges,
+                           int          edgeCount,
+                     const StrokeStyle &style,
+                     const DirtyRect   &clipRect);
+
+
+#endif
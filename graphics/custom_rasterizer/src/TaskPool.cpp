@@ -0,0 +1,187 @@
+/*!
+*****************************************************************************
+\file   TaskPool.cpp
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the implementation of the TaskPool class' methods.
+*******************************************************************************/
+#include "TaskPool.h"
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+
+
+/*############################################################################*/
+/*############################## Public Methods ##############################*/
+/*############################################################################*/
+
+  /* Non-Default Constructor. */
+TaskPool::TaskPool(int threadCount)
+  : mWorkers(),
+    mTimings(),
+    mMutex(),
+    mJobReady(),
+    mJobDone(),
+    mpJob(NULL),
+    mJobCount(0),
+    mJobThreads(0),
+    mGeneration(0),
+    mPending(0),
+    mJobError(),
+    mShutdown(false)
+{
+    /* Default to one thread per core (hardware_concurrency may report 0). */
+  if (threadCount <= 0)
+    threadCount = static_cast<int>(std::thread::hardware_concurrency());
+  if (threadCount <= 0)
+    threadCount = 1;
+
+  mTimings.assign(threadCount, 0.0);
+    /* The calling thread acts as worker 0, so only spawn the others. */
+  for (int i = 1; i < threadCount; ++i)
+    mWorkers.push_back(std::thread(&TaskPool::WorkerLoop, this, i));
+}
+
+  /* Default Destructor. */
+TaskPool::~TaskPool(void)
+{
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mShutdown = true;
+  }
+  mJobReady.notify_all();
+
+  for (auto iter = mWorkers.begin(); iter != mWorkers.end(); ++iter)
+    iter->join();
+}
+
+  /* Get the number of threads (including the caller) that run a range. */
+int TaskPool::ThreadCount(void) const
+{ return static_cast<int>(mWorkers.size() + 1); }
+
+  /* Get the time each thread spent on its chunk during the last job. */
+const std::vector<double> &TaskPool::LastTimings(void) const
+{ return mTimings; }
+
+  /* Split [0, count) into one chunk per thread and run them in parallel. */
+void TaskPool::ParallelFor(int count, const RangeFn &fn, int minChunk)
+{
+  std::fill(mTimings.begin(), mTimings.end(), 0.0);
+  if (count <= 0)
+    return;
+  if (minChunk < 1)
+    minChunk = 1;
+
+    /* Only use as many threads as there are [minChunk] sized chunks. */
+  int threads = std::min(ThreadCount(), std::max(1, (count / minChunk)));
+
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+      /* The pool runs one job at a time (a nested call would overwrite it). */
+    assert((mpJob == NULL) && "TaskPool::ParallelFor is not re-entrant");
+    mpJob       = &fn;
+    mJobCount   = count;
+    mJobThreads = threads;
+    mPending    = (threads - 1);
+    ++mGeneration;
+  }
+  if (threads > 1)
+    mJobReady.notify_all();
+
+    /*
+     * Run the first chunk on the calling thread. Should it throw, the other
+     * chunks (which still use [fn]) must finish before the job is cleared.
+     */
+  std::exception_ptr error;
+  try
+  {
+    RunChunk(0);
+  }
+  catch (...)
+  {
+    error = std::current_exception();
+  }
+
+    /* Wait for every other chunk to finish. */
+  {
+    std::unique_lock<std::mutex> lock(mMutex);
+    mJobDone.wait(lock, [this] { return (mPending == 0); });
+    mpJob = NULL;
+    if (!error)
+      error = mJobError;
+    mJobError = std::exception_ptr();
+  }
+
+  if (error)
+    std::rethrow_exception(error);
+}
+
+
+/*############################################################################*/
+/*############################# Private Methods ##############################*/
+/*############################################################################*/
+
+  /* Main loop of each worker thread. */
+void TaskPool::WorkerLoop(int thread)
+{
+  unsigned seenGeneration = 0;
+
+  for (;;)
+  {
+    {
+      std::unique_lock<std::mutex> lock(mMutex);
+      mJobReady.wait(lock, [this, seenGeneration]
+                           { return (mShutdown ||
+                                     (mGeneration != seenGeneration)); });
+      if (mShutdown)
+        return;
+
+      seenGeneration = mGeneration;
+        /* This job does not need this thread. */
+      if (thread >= mJobThreads)
+        continue;
+    }
+
+      /* Hand any exception to the caller rather than ending the program. */
+    std::exception_ptr error;
+    try
+    {
+      RunChunk(thread);
+    }
+    catch (...)
+    {
+      error = std::current_exception();
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mMutex);
+      if (error && !mJobError)
+        mJobError = error;
+      if (--mPending == 0)
+        mJobDone.notify_one();
+    }
+  }
+}
+
+  /* Run (and time) the chunk belonging to [thread] for the current job. */
+void TaskPool::RunChunk(int thread)
+{
+  typedef std::chrono::steady_clock Clock;
+
+    /* Deterministic contiguous split of [0, mJobCount). */
+  int begin = static_cast<int>((static_cast<long long>(mJobCount) * thread) /
+                               mJobThreads);
+  int end   = static_cast<int>((static_cast<long long>(mJobCount) * (thread + 1)) /
+                               mJobThreads);
+
+  Clock::time_point start = Clock::now();
+  (*mpJob)(begin, end, thread);
+  mTimings[thread] =
+    std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
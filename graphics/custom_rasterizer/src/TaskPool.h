@@ -0,0 +1,127 @@
+/*!
+*****************************************************************************
+\file   TaskPool.h
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the definition of the TaskPool class, a small fixed-size
+  pool of worker threads used to run data-parallel stages of the frame (e.g.
+  updating and transforming the dynamic objects) across every core.
+*******************************************************************************/
+#ifndef TASKPOOL_H
+#define TASKPOOL_H
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+/*!
+******************************************************************************
+  \class TaskPool
+
+  \brief
+    Owns a set of persistent worker threads and splits index ranges across
+    them. Ranges are always split into the same contiguous chunks for a given
+    count and thread count (chunk i is [(count * i) / n, (count * (i + 1)) / n)),
+    so the work each thread does is deterministic from frame to frame. The
+    calling thread participates as worker 0, and the time each worker spends
+    on its chunk is recorded so the stage can be profiled per thread.
+*******************************************************************************/
+class TaskPool
+{
+/*############################################################################*/
+/*############################## Public Defines ##############################*/
+/*############################################################################*/
+public:
+    /* Work callback: [begin, end) index range and the index of the worker. */
+  typedef std::function<void(int begin, int end, int thread)> RangeFn;
+
+
+/*############################################################################*/
+/*############################## Public Methods ##############################*/
+/*############################################################################*/
+public:
+
+  /******************************* Constructors *******************************/
+    /*
+     * Non-Default Constructor. A thread count of 0 (or less) uses one thread
+     * per hardware core.
+     */
+  explicit TaskPool(int threadCount = 0);
+    /* Default Destructor. Joins every worker thread. */
+  ~TaskPool(void);
+
+  /********************************* Getters **********************************/
+    /* Get the number of threads (including the caller) that run a range. */
+  int ThreadCount(void) const;
+    /*
+     * Get the time (in milliseconds) each thread spent on its chunk during the
+     * last call to ParallelFor(). Threads that were given no work report 0.
+     */
+  const std::vector<double> &LastTimings(void) const;
+
+  /********************************* Mutators *********************************/
+    /*
+     * Split [0, count) into one contiguous chunk per thread and call [fn] on
+     * each chunk in parallel, returning once every chunk has finished. Ranges
+     * smaller than [minChunk] per thread use fewer threads so tiny stages do
+     * not pay for waking the whole pool. Must not be called again until it
+     * returns (e.g. from inside [fn]). If [fn] throws on any thread, the
+     * first exception is rethrown once every chunk has finished.
+     */
+  void ParallelFor(int count, const RangeFn &fn, int minChunk = 1);
+
+
+/*############################################################################*/
+/*############################# Private Methods ##############################*/
+/*############################################################################*/
+private:
+    /* Non-copyable. */
+  TaskPool(const TaskPool &);
+  TaskPool &operator=(const TaskPool &);
+    /* Main loop of each worker thread. */
+  void WorkerLoop(int thread);
+    /* Run (and time) the chunk belonging to [thread] for the current job. */
+  void RunChunk(int thread);
+
+
+/*############################################################################*/
+/*############################# Private Members ##############################*/
+/*############################################################################*/
+private:
+    /* The worker threads (worker 0 is the calling thread, so it is absent). */
+  std::vector<std::thread> mWorkers;
+    /* Per-thread timings (in milliseconds) of the last job. */
+  std::vector<double>      mTimings;
+    /* Guards the job description below. */
+  std::mutex               mMutex;
+    /* Signals the workers that a new job (or shutdown) is available. */
+  std::condition_variable  mJobReady;
+    /* Signals the caller that the last worker has finished its chunk. */
+  std::condition_variable  mJobDone;
+    /* The current job. */
+  const RangeFn           *mpJob;
+  int                      mJobCount;
+  int                      mJobThreads;
+    /* Incremented for every job so workers can tell new jobs from old ones. */
+  unsigned                 mGeneration;
+    /* Number of worker threads that have not yet finished the current job. */
+  int                      mPending;
+    /* The first exception a worker's chunk of the current job threw. */
+  std::exception_ptr       mJobError;
+    /* Set when the pool is being destroyed. */
+  bool                     mShutdown;
+};
+
+
+#endif
+
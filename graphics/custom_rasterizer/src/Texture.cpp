@@ -0,0 +1,205 @@
+/*!
+*****************************************************************************
+\file   Texture.cpp
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the implementation of the Texture class's methods. Each
+  mipmap level is the average of the 2x2 texels below it (or of the 2x1
+  texels, once one of the dimensions has reached a single texel).
+*******************************************************************************/
+#include "Texture.h"
+#include <algorithm>
+
+
+/*############################################################################*/
+/*########################## Local Helper Functions ##########################*/
+/*############################################################################*/
+
+  /* Whether [n] is a (positive) power of two. */
+inline
+bool IsPowerOfTwo(int n)
+{ return ((n > 0) && ((n & (n - 1)) == 0)); }
+
+
+/*############################################################################*/
+/*######################### Function Implementation ##########################*/
+/*############################################################################*/
+
+  /* Default Constructor (an empty texture). */
+Texture::Texture(void) : mLevels(), mTexels(), mBilinear(true) { ; }
+
+  /* Get the width (in texels) of mipmap level [level]. */
+int Texture::Width(int level) const { return mLevels[level].mWidth; }
+
+  /* Get the height (in texels) of mipmap level [level]. */
+int Texture::Height(int level) const { return mLevels[level].mHeight; }
+
+  /* Get the number of mipmap levels (0 while the texture is empty). */
+int Texture::LevelCount(void) const { return static_cast<int>(mLevels.size()); }
+
+/*!
+******************************************************************************
+  \fn bool Texture::Load(int width, int height, const Color *pTexels)
+
+  \brief
+    Replace the image and build its mipmaps.
+
+  \param width
+    The width (in texels) of the image, a power of two.
+
+  \param height
+    The height (in texels) of the image, a power of two.
+
+  \param pTexels
+    The texels of the image, row by row from the bottom up.
+
+  \return
+    Whether the image was loaded (false if its dimensions are not powers of
+    two, in which case the texture is left empty).
+*******************************************************************************/
+bool Texture::Load(int width, int height, const Color *pTexels)
+{
+  mLevels.clear();
+  mTexels.clear();
+  if (!IsPowerOfTwo(width) || !IsPowerOfTwo(height) || !pTexels)
+    return false;
+
+    /* Lay out every level up front, each padded to whole tiles. */
+  std::size_t total = 0;
+  for (int w = width, h = height; ; w = std::max(1, (w / 2)), h = std::max(1, (h / 2)))
+  {
+    Level level;
+    level.mWidth       = w;
+    level.mHeight      = h;
+    level.mTilesAcross = ((w + scmTileSize - 1) / scmTileSize);
+    level.mOffset      = total;
+    mLevels.push_back(level);
+    total += (static_cast<std::size_t>(level.mTilesAcross) *
+              ((h + scmTileSize - 1) / scmTileSize) * scmTileSize * scmTileSize);
+    if ((w == 1) && (h == 1))
+      break;
+  }
+  mTexels.resize(total);
+
+  for (int y = 0; y < height; ++y)
+    for (int x = 0; x < width; ++x)
+      mTexels[Index(mLevels[0], x, y)] = pTexels[(y * width) + x];
+
+    /* Filter each level down from the one before it. */
+  for (std::size_t i = 1; i < mLevels.size(); ++i)
+  {
+    const Level &src = mLevels[i - 1];
+    const Level &dst = mLevels[i];
+    const int    sx  = (src.mWidth  / dst.mWidth);
+    const int    sy  = (src.mHeight / dst.mHeight);
+    for (int y = 0; y < dst.mHeight; ++y)
+      for (int x = 0; x < dst.mWidth; ++x)
+      {
+        int sum[3] = { 0, 0, 0 };
+        for (int j = 0; j < sy; ++j)
+          for (int k = 0; k < sx; ++k)
+          {
+            const Color &texel = mTexels[Index(src, ((x * sx) + k), ((y * sy) + j))];
+            sum[0] += texel.red;
+            sum[1] += texel.grn;
+            sum[2] += texel.blu;
+          }
+        const int n = (sx * sy);
+        mTexels[Index(dst, x, y)] = Color(static_cast<Cval>((sum[0] + (n / 2)) / n),
+                                          static_cast<Cval>((sum[1] + (n / 2)) / n),
+                                          static_cast<Cval>((sum[2] + (n / 2)) / n));
+      }
+  }
+  return true;
+}
+
+/*!
+******************************************************************************
+  \fn void Texture::SampleSpan(int level, Fixed u, Fixed v, Fixed du,
+                               Fixed dv, int count, Raster::byte *pRgb) const
+
+  \brief
+    Sample a span of pixels from one of the mipmap levels, either from the
+    texel nearest each pixel or by blending the four texels around it.
+
+  \param level
+    The mipmap level to sample.
+
+  \param u, v
+    The texel coordinates of the first pixel.
+
+  \param du, dv
+    The change in the texel coordinates per pixel.
+
+  \param count
+    The number of pixels to sample.
+
+  \param pRgb
+    Where the pixels' colors are written.
+*******************************************************************************/
+void Texture::SampleSpan(int level, Fixed u, Fixed v, Fixed du, Fixed dv,
+                         int count, Raster::byte *pRgb) const
+{
+  const Level   &lvl      = mLevels[level];
+  const Color   *pTexels  = &mTexels[lvl.mOffset];
+  const unsigned wMask    = static_cast<unsigned>(lvl.mWidth  - 1);
+  const unsigned hMask    = static_cast<unsigned>(lvl.mHeight - 1);
+    /* Texels per row of tiles. */
+  const unsigned rowPitch = static_cast<unsigned>(lvl.mTilesAcross * scmTileSize * scmTileSize);
+    /*
+     * A texel's index splits into a part from its column and a part from its
+     * row, so the four texels around a sample only need two of each.
+     */
+  auto column = [] (unsigned x)
+                { return (((x / scmTileSize) * scmTileSize * scmTileSize) + (x & (scmTileSize - 1))); };
+  auto row    = [rowPitch] (unsigned y)
+                { return (((y / scmTileSize) * rowPitch) + ((y & (scmTileSize - 1)) * scmTileSize)); };
+
+  if (!mBilinear)
+  {
+    for (/* count = count */; 0 < count; --count, pRgb += 3, u += du, v += dv)
+    {
+      const Color &texel = pTexels[column(static_cast<unsigned>(u >> gFracBits) & wMask) +
+                                   row   (static_cast<unsigned>(v >> gFracBits) & hMask)];
+      pRgb[0] = texel.red;
+      pRgb[1] = texel.grn;
+      pRgb[2] = texel.blu;
+    }
+    return;
+  }
+
+  u -= (gFixedOne / 2);
+  v -= (gFixedOne / 2);
+  for (/* count = count */; 0 < count; --count, pRgb += 3, u += du, v += dv)
+  {
+    const unsigned tx = static_cast<unsigned>(u >> gFracBits);
+    const unsigned ty = static_cast<unsigned>(v >> gFracBits);
+      /* The sample's position between the texels, in 1/256ths. */
+    const int      fx = static_cast<int>((u >> (gFracBits - 8)) & 255);
+    const int      fy = static_cast<int>((v >> (gFracBits - 8)) & 255);
+    const unsigned x0 = column(tx & wMask);
+    const unsigned x1 = column((tx + 1) & wMask);
+    const unsigned y0 = row(ty & hMask);
+    const unsigned y1 = row((ty + 1) & hMask);
+    const Color   &a  = pTexels[x0 + y0];
+    const Color   &b  = pTexels[x1 + y0];
+    const Color   &c  = pTexels[x0 + y1];
+    const Color   &d  = pTexels[x1 + y1];
+      /* Blend along x on both rows (in 1/256ths), then between the rows. */
+    const int      r0 = ((a.red << 8) + ((b.red - a.red) * fx));
+    const int      g0 = ((a.grn << 8) + ((b.grn - a.grn) * fx));
+    const int      b0 = ((a.blu << 8) + ((b.blu - a.blu) * fx));
+    const int      r1 = ((c.red << 8) + ((d.red - c.red) * fx));
+    const int      g1 = ((c.grn << 8) + ((d.grn - c.grn) * fx));
+    const int      b1 = ((c.blu << 8) + ((d.blu - c.blu) * fx));
+    pRgb[0] = static_cast<Raster::byte>(((r0 << 8) + ((r1 - r0) * fy)) >> 16);
+    pRgb[1] = static_cast<Raster::byte>(((g0 << 8) + ((g1 - g0) * fy)) >> 16);
+    pRgb[2] = static_cast<Raster::byte>(((b0 << 8) + ((b1 - b0) * fy)) >> 16);
+  }
+}
@@ -0,0 +1,185 @@
+/*!
+*****************************************************************************
+\file   Texture.h
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the definition of the Texture class, an image (and the
+  chain of its mipmaps) stored in small square tiles so that the texels
+  sampled for neighboring pixels tend to share cache lines, whichever way the
+  image is walked.
+*******************************************************************************/
+#ifndef TEXTURE_H
+#define TEXTURE_H
+
+#include "Color.h"
+#include "FixedPoint.h"
+#include <cstddef>
+#include <vector>
+
+
+/*!
+******************************************************************************
+  \class Texture
+
+  \brief
+    An image with power of two dimensions, along with each of its mipmaps
+    (down to a single texel), sampled with wrapping texel coordinates.
+*******************************************************************************/
+class Texture
+{
+/*############################################################################*/
+/*############################## Public Methods ##############################*/
+/*############################################################################*/
+public:
+
+  /******************************* Constructors *******************************/
+    /* Default Constructor (an empty texture). */
+  Texture(void);
+
+  /********************************* Getters **********************************/
+    /* Get the width/height (in texels) of mipmap level [level]. */
+  int Width (int level = 0) const;
+  int Height(int level = 0) const;
+    /* Get the number of mipmap levels (0 while the texture is empty). */
+  int LevelCount(void) const;
+    /*
+     * Get the texel (x, y) of mipmap level [level]; x and y wrap around the
+     * edges of the level.
+     */
+  const Color &Texel(int level, int x, int y) const;
+    /*
+     * Whether the texture is sampled by blending the four texels nearest each
+     * pixel (rather than by taking the nearest one).
+     */
+  bool Bilinear(void) const;
+    /*
+     * Sample [count] pixels from mipmap level [level] into [pRgb] (three
+     * bytes per pixel: red, green, blue), starting at the texel coordinates
+     * ([u], [v]) of the level and stepping by ([du], [dv]) per pixel (all in
+     * fixed point). Texel centers lie halfway between texel coordinates.
+     */
+  void SampleSpan(int level, Fixed u, Fixed v, Fixed du, Fixed dv,
+                  int count, Raster::byte *pRgb) const;
+
+  /********************************* Setters **********************************/
+    /* Set whether the texture is sampled bilinearly (see above). */
+  void SetBilinear(bool bilinear);
+
+  /********************************* Mutators *********************************/
+    /*
+     * Replace the image by the [width] x [height] texels at [pTexels] (row by
+     * row, from the bottom up) and build its mipmaps. Returns false (leaving
+     * the texture empty) unless both dimensions are powers of two.
+     */
+  bool Load(int width, int height, const Color *pTexels);
+
+
+/*############################################################################*/
+/*############################## Private Defines #############################*/
+/*############################################################################*/
+private:
+    /* The texels along each side of a tile (a power of two). */
+  static const int scmTileSize = 4;
+    /* Where each mipmap level is kept. */
+  struct Level
+  {
+    int         mWidth;
+    int         mHeight;
+      /* Number of tiles along each row of the level. */
+    int         mTilesAcross;
+      /* Index of the level's first texel in mTexels. */
+    std::size_t mOffset;
+  };
+
+
+/*############################################################################*/
+/*############################# Private Methods ##############################*/
+/*############################################################################*/
+private:
+    /* Get the index in mTexels of the texel (x, y) of [level]. */
+  std::size_t Index(const Level &level, int x, int y) const;
+
+
+/*############################################################################*/
+/*############################# Private Members ##############################*/
+/*############################################################################*/
+private:
+  std::vector<Level> mLevels;
+    /* The texels of every level, each stored tile by tile. */
+  std::vector<Color> mTexels;
+  bool               mBilinear;
+};
+
+
+/*############################################################################*/
+/*########################## Inline Implementations ##########################*/
+/*############################################################################*/
+
+/*!
+******************************************************************************
+  \fn std::size_t Index(const Level &level, int x, int y) const
+
+  \brief
+    Get the index in mTexels of the texel (x, y) of the given level: tiles are
+    stored row by row, and so are the texels within each tile.
+*******************************************************************************/
+inline
+std::size_t Texture::Index(const Level &level, int x, int y) const
+{
+  const int tile = (((y / scmTileSize) * level.mTilesAcross) + (x / scmTileSize));
+  return (level.mOffset +
+          static_cast<std::size_t>((tile * scmTileSize * scmTileSize) +
+                                   ((y & (scmTileSize - 1)) * scmTileSize) +
+                                    (x & (scmTileSize - 1))));
+}
+
+/*!
+******************************************************************************
+  \fn bool Bilinear(void) const
+
+  \brief
+    Whether the texture is sampled by blending the four texels nearest each
+    pixel (rather than by taking the nearest one).
+*******************************************************************************/
+inline
+bool Texture::Bilinear(void) const
+{
+  return mBilinear;
+}
+
+/*!
+******************************************************************************
+  \fn void SetBilinear(bool bilinear)
+
+  \brief
+    Set whether the texture is sampled bilinearly.
+*******************************************************************************/
+inline
+void Texture::SetBilinear(bool bilinear)
+{
+  mBilinear = bilinear;
+}
+
+/*!
+******************************************************************************
+  \fn const Color &Texel(int level, int x, int y) const
+
+  \brief
+    Get the texel (x, y) of mipmap level [level]; x and y wrap around the
+    edges of the level.
+*******************************************************************************/
+inline
+const Color &Texture::Texel(int level, int x, int y) const
+{
+  const Level &lvl = mLevels[level];
+  return mTexels[Index(lvl, (x & (lvl.mWidth - 1)), (y & (lvl.mHeight - 1)))];
+}
+
+
+#endif
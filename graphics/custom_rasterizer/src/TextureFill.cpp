@@ -0,0 +1,283 @@
+/*!
+*****************************************************************************
+\file   TextureFill.cpp
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the implementation of the UVPlane struct's methods,
+  FillTexturedTriangle and DrawSprite.
+
+  Texture coordinates are affine in device coordinates (there is no
+  perspective), so each span finds its texel coordinates once, at its first
+  pixel, then steps them in fixed point. Spans are sampled (see
+  Texture::SampleSpan) into a small buffer of pixels, a chunk at a time,
+  which is then tinted and written out in one go.
+*******************************************************************************/
+#include "TextureFill.h"
+#include "FixedPoint.h"
+#include "TriangleSpans.h"
+#include <algorithm>
+#include <cmath>
+
+
+/*############################################################################*/
+/*############################# Global Constants #############################*/
+/*############################################################################*/
+
+  /* Number of pixels sampled before being written to the frame buffer. */
+static const int gChunkPixels = 64;
+
+
+/*############################################################################*/
+/*########################## Local Helper Functions ##########################*/
+/*############################################################################*/
+
+  /*
+   * Pick the mipmap level of [texture] to sample when the texture
+   * coordinates change by ([dudx], [dvdx]) per pixel along x and by
+   * ([dudy], [dvdy]) along y: the most detailed level stepping over fewer
+   * than two of its texels per pixel (or else the single texel level).
+   */
+static int PickLevel(const Texture &texture,
+                           double   dudx,
+                           double   dvdx,
+                           double   dudy,
+                           double   dvdy)
+{
+  const double w   = static_cast<double>(texture.Width());
+  const double h   = static_cast<double>(texture.Height());
+  double       rho = std::max(std::hypot((dudx * w), (dvdx * h)),
+                              std::hypot((dudy * w), (dvdy * h)));
+  int          level = 0;
+  while ((rho >= 2.0) && (level < (texture.LevelCount() - 1)))
+  {
+    rho *= 0.5;
+    ++level;
+  }
+  return level;
+}
+
+  /*
+   * Convert the texel coordinate [t] of a level [size] texels across, and its
+   * change per pixel along x/y, to fixed point. Coordinates wrap, so [t] is
+   * first brought within the level to keep them small. The level picked
+   * steps over fewer than two texels per pixel, except for the single texel
+   * level, whose steps can be dropped altogether.
+   */
+static void ToFixedTexels(double t, double dx, double dy, double size, bool single,
+                          Fixed &ft, Fixed &fdx, Fixed &fdy)
+{
+  ft  = ToFixed(t - (std::floor(t / size) * size));
+  fdx = (single ? 0 : ToFixed(dx));
+  fdy = (single ? 0 : ToFixed(dy));
+}
+
+  /*
+   * Write the [count] pixels of scanline [y] starting at pixel [x], sampled
+   * from mipmap level [level] of [texture] starting at its texel coordinates
+   * ([u], [v]) and stepping by ([du], [dv]) per pixel (in fixed point).
+   */
+static void TextureSpan(      Raster  &raster,
+                        const Texture &texture,
+                              int      level,
+                              int      x,
+                              int      y,
+                              int      count,
+                              Fixed    u,
+                              Fixed    v,
+                              Fixed    du,
+                              Fixed    dv,
+                        const Color   &tint)
+{
+    /* Tinting by (channel + 1) / 256 leaves colors unchanged under white. */
+  const int  tint3[3] = { (tint.red + 1), (tint.grn + 1), (tint.blu + 1) };
+  const bool tinted   = ((tint.red & tint.grn & tint.blu) != 255);
+
+  Raster::byte rgb[3 * gChunkPixels];
+  for (int done = 0; done < count; done += gChunkPixels)
+  {
+    const int n = std::min(gChunkPixels, (count - done));
+    texture.SampleSpan(level, (u + (du * done)), (v + (dv * done)), du, dv, n, rgb);
+    if (tinted)
+      for (int i = 0; i < (3 * n); i += 3)
+      {
+        rgb[i]     = static_cast<Raster::byte>((rgb[i]     * tint3[0]) >> 8);
+        rgb[i + 1] = static_cast<Raster::byte>((rgb[i + 1] * tint3[1]) >> 8);
+        rgb[i + 2] = static_cast<Raster::byte>((rgb[i + 2] * tint3[2]) >> 8);
+      }
+    raster.GotoPoint((x + done), y);
+    raster.WritePixels(n, rgb);
+  }
+}
+
+
+/*############################################################################*/
+/*######################### Function Implementation ##########################*/
+/*############################################################################*/
+
+/*!
+******************************************************************************
+  \fn void UVPlane::Init(const Point &P, const Point &Q, const Point &R,
+                         const Point &uvP, const Point &uvQ,
+                         const Point &uvR)
+
+  \brief
+    Fit the plane through the texture coordinates of the corners of a
+    triangle.
+
+  \param P, Q, R
+    The corners of the triangle, in device coordinates.
+
+  \param uvP, uvQ, uvR
+    The texture coordinates of the corners.
+*******************************************************************************/
+void UVPlane::Init(const Point &P,   const Point &Q,   const Point &R,
+                   const Point &uvP, const Point &uvQ, const Point &uvR)
+{
+  const double ux  = (static_cast<double>(Q.x) - P.x);
+  const double uy  = (static_cast<double>(Q.y) - P.y);
+  const double vx  = (static_cast<double>(R.x) - P.x);
+  const double vy  = (static_cast<double>(R.y) - P.y);
+  const double det = ((ux * vy) - (uy * vx));
+  const double p[2] = { static_cast<double>(uvP.x), static_cast<double>(uvP.y) };
+  const double q[2] = { static_cast<double>(uvQ.x), static_cast<double>(uvQ.y) };
+  const double r[2] = { static_cast<double>(uvR.x), static_cast<double>(uvR.y) };
+
+  for (int c = 0; c < 2; ++c)
+  {
+    mDx[c] = 0.0;
+    mDy[c] = 0.0;
+    if (det != 0.0)
+    {
+        /* Solve for the change along x/y from the changes along PQ and PR. */
+      const double dq = (q[c] - p[c]);
+      const double dr = (r[c] - p[c]);
+      mDx[c] = (((dq * vy) - (dr * uy)) / det);
+      mDy[c] = (((dr * ux) - (dq * vx)) / det);
+    }
+    mBase[c] = (p[c] - (mDx[c] * P.x) - (mDy[c] * P.y));
+  }
+}
+
+/*!
+******************************************************************************
+  \fn void FillTexturedTriangle(Raster &raster, const Point &P,
+                                const Point &Q, const Point &R,
+                                const UVPlane &plane,
+                                const Texture &texture, const Color &tint)
+
+  \brief
+    Fill a triangle with a texture.
+
+  \param raster
+    The Raster object that the triangle will be drawn to.
+
+  \param P, Q, R
+    The corners of the triangle, in device coordinates.
+
+  \param plane
+    The texture coordinates of the triangle.
+
+  \param texture
+    The texture to fill the triangle with.
+
+  \param tint
+    The color the texture is tinted by.
+*******************************************************************************/
+void FillTexturedTriangle(      Raster  &raster,
+                          const Point   &P,
+                          const Point   &Q,
+                          const Point   &R,
+                          const UVPlane &plane,
+                          const Texture &texture,
+                          const Color   &tint)
+{
+  if (!texture.LevelCount())
+    return;
+
+  const int    level  = PickLevel(texture, plane.mDx[0], plane.mDx[1],
+                                           plane.mDy[0], plane.mDy[1]);
+  const bool   single = (level == (texture.LevelCount() - 1));
+  const double w      = static_cast<double>(texture.Width(level));
+  const double h      = static_cast<double>(texture.Height(level));
+
+    /* The texel coordinates at the device origin, and their change per pixel. */
+  Fixed u, dudx, dudy;
+  Fixed v, dvdx, dvdy;
+  ToFixedTexels((w * plane.mBase[0]), (w * plane.mDx[0]), (w * plane.mDy[0]), w, single,
+                u, dudx, dudy);
+  ToFixedTexels((h * plane.mBase[1]), (h * plane.mDx[1]), (h * plane.mDy[1]), h, single,
+                v, dvdx, dvdy);
+
+  ForEachTriangleSpan(P, Q, R,
+                      [&] (int y, int x0, int x1)
+                      {
+                        TextureSpan(raster, texture, level, x0, y, (x1 - x0),
+                                    (u + (dudx * x0) + (dudy * y)),
+                                    (v + (dvdx * x0) + (dvdy * y)),
+                                    dudx, dvdx, tint);
+                      } );
+}
+
+/*!
+******************************************************************************
+  \fn void DrawSprite(Raster &raster, const Texture &texture, float x,
+                      float y, float width, float height, const Color &tint)
+
+  \brief
+    Draw a texture as an axis-aligned sprite.
+
+  \param raster
+    The Raster object that the sprite will be drawn to.
+
+  \param texture
+    The texture to draw.
+
+  \param x, y
+    The device coordinates of the sprite's bottom-left corner.
+
+  \param width, height
+    The size (in pixels) the sprite is drawn at.
+
+  \param tint
+    The color the texture is tinted by.
+*******************************************************************************/
+void DrawSprite(      Raster  &raster,
+                const Texture &texture,
+                      float    x,
+                      float    y,
+                      float    width,
+                      float    height,
+                const Color   &tint)
+{
+  if (!texture.LevelCount() || !(width > 0.0f) || !(height > 0.0f))
+    return;
+
+    /* The pixel centers covered by the sprite, clipped to the screen. */
+  const int x0 = std::max(static_cast<int>(std::ceil(x)), 0);
+  const int y0 = std::max(static_cast<int>(std::ceil(y)), 0);
+  const int x1 = std::min(static_cast<int>(std::ceil(x + width)),  raster.Width());
+  const int y1 = std::min(static_cast<int>(std::ceil(y + height)), raster.Height());
+  if ((x0 >= x1) || (y0 >= y1))
+    return;
+
+  const int    level  = PickLevel(texture, (1.0 / width), 0.0, 0.0, (1.0 / height));
+  const bool   single = (level == (texture.LevelCount() - 1));
+  const double w      = static_cast<double>(texture.Width(level));
+  const double h      = static_cast<double>(texture.Height(level));
+
+    /* The texel coordinates of the first pixel, and their change per pixel. */
+  Fixed u, dudx, dudy;
+  Fixed v, dvdx, dvdy;
+  ToFixedTexels(((w * (x0 - static_cast<double>(x))) / width), (w / width), 0.0, w, single,
+                u, dudx, dudy);
+  ToFixedTexels(((h * (y0 - static_cast<double>(y))) / height), 0.0, (h / height), h, single,
+                v, dvdx, dvdy);
+  for (int row = y0; row < y1; ++row, v += dvdy)
+    TextureSpan(raster, texture, level, x0, row, (x1 - x0), u, v, dudx, 0, tint);
+}
@@ -0,0 +1,88 @@
+/*!
+*****************************************************************************
+\file   TextureFill.h
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains the definition of the UVPlane struct and the prototypes
+  of FillTexturedTriangle and DrawSprite, which fill triangles/rectangles
+  with a Texture.
+*******************************************************************************/
+#ifndef TEXTUREFILL_H
+#define TEXTUREFILL_H
+
+#include "Affine.h"
+#include "Color.h"
+#include "Raster.h"
+#include "Texture.h"
+
+
+/*!
+******************************************************************************
+  \struct UVPlane
+
+  \brief
+    The texture coordinates of a textured triangle as a function of device
+    coordinates: u and v are each (mBase + (mDx * x) + (mDy * y)), with
+    (0, 0) and (1, 1) the opposite corners of the texture (which repeats
+    beyond them). As with ColorPlane, the pieces a triangle is clipped into
+    share the same UVPlane.
+*******************************************************************************/
+struct UVPlane
+{
+    /* u and v at the device origin. */
+  double mBase[2];
+    /* The change in u and v per pixel along the x-/y-axis. */
+  double mDx[2];
+  double mDy[2];
+
+    /*
+     * Fit the plane through the texture coordinates [uvP], [uvQ] and [uvR]
+     * (as (u, v) points) of the corners [P], [Q] and [R] of a triangle.
+     * Degenerate triangles get the texture coordinates [uvP] throughout.
+     */
+  void Init(const Point &P,   const Point &Q,   const Point &R,
+            const Point &uvP, const Point &uvQ, const Point &uvR);
+};
+
+
+/*############################################################################*/
+/*########################### Function Prototypes ############################*/
+/*############################################################################*/
+
+  /*
+   * Fill the triangle [P][Q][R] (in device coordinates, already clipped to
+   * the screen) to the Raster object's pixel buffer with [texture], mapped by
+   * [plane] and tinted by [tint] (white leaving it unchanged). The pixels
+   * filled are the ones FillTriangle fills. The mipmap level is picked once
+   * for the whole triangle, from how many texels [plane] steps over per
+   * pixel, and is then sampled as set by Texture::SetBilinear().
+   */
+void FillTexturedTriangle(      Raster  &raster,
+                          const Point   &P,
+                          const Point   &Q,
+                          const Point   &R,
+                          const UVPlane &plane,
+                          const Texture &texture,
+                          const Color   &tint = Color(255, 255, 255));
+  /*
+   * Draw [texture] as a sprite stretched over the pixel centers in
+   * [x, x + width) x [y, y + height) of the Raster object's pixel buffer
+   * (clipped to it), the texture's bottom-left corner at (x, y). Filtered and
+   * tinted as for FillTexturedTriangle.
+   */
+void DrawSprite(      Raster  &raster,
+                const Texture &texture,
+                      float    x,
+                      float    y,
+                      float    width,
+                      float    height,
+                const Color   &tint = Color(255, 255, 255));
+
+
+#endif
@@ -0,0 +1,83 @@
+/*!
+*****************************************************************************
+\file   TriangleSpans.h
+\author Connor Bracy
+\par    DigiPen Login: connor.bracy
+\par    DP email: connor.bracy\@digipen.edu
+\par    Course: CS200
+\par    Project #2
+\date   10/18/2026
+
+\brief
+  This file contains ForEachTriangleSpan, the scanline walk shared by the
+  fills that compute their own colors (shaded, textured) for the pixels
+  FillTriangle would fill.
+*******************************************************************************/
+#ifndef TRIANGLESPANS_H
+#define TRIANGLESPANS_H
+
+#include "Affine.h"
+#include <algorithm>
+#include <cmath>
+
+
+/*!
+******************************************************************************
+  \fn void ForEachTriangleSpan(const Point &P, const Point &Q,
+                               const Point &R, SpanFn fn)
+
+  \brief
+    Call [fn](y, x0, x1) for each non-empty span of pixels [x0, x1) on
+    scanline y that FillTriangle fills for the triangle [P][Q][R] (the pixel
+    centers in [left, right) on the scanlines in [bottom, top)), from the
+    bottom scanline up.
+
+  \param P, Q, R
+    The corners of the triangle, in device coordinates.
+
+  \param fn
+    The function called for each span.
+*******************************************************************************/
+template <typename SpanFn>
+void ForEachTriangleSpan(const Point &P, const Point &Q, const Point &R, SpanFn fn)
+{
+    /* Sort the corners from the bottom up. */
+  const Point *pCorners[3] = { &P, &Q, &R };
+  std::sort(pCorners, (pCorners + 3),
+            [] (const Point *pLhs, const Point *pRhs) { return (pLhs->y < pRhs->y); } );
+  const Point &A = *pCorners[0];
+  const Point &B = *pCorners[1];
+  const Point &C = *pCorners[2];
+  if (!(A.y < C.y))
+    return;
+
+  const int yMid = static_cast<int>(std::ceil(B.y));
+  const int yEnd = static_cast<int>(std::ceil(C.y));
+  int       y    = static_cast<int>(std::ceil(A.y));
+
+    /* The long side, AC, bounds every scanline; AB then BC bound the rest. */
+  const double stepAC = ((static_cast<double>(C.x) - A.x) / (static_cast<double>(C.y) - A.y));
+  double       xAC    = (A.x + (stepAC * (y - static_cast<double>(A.y))));
+
+  for (int half = 0; half < 2; ++half)
+  {
+    const Point &U     = (half ? B : A);
+    const Point &V     = (half ? C : B);
+    const int    yStop = (half ? yEnd : yMid);
+    if (!(U.y < V.y))
+      continue;
+
+    const double stepUV = ((static_cast<double>(V.x) - U.x) / (static_cast<double>(V.y) - U.y));
+    double       xUV    = (U.x + (stepUV * (y - static_cast<double>(U.y))));
+    for (/* y = y */; y < yStop; ++y, xAC += stepAC, xUV += stepUV)
+    {
+      const int x0 = static_cast<int>(std::ceil(std::min(xAC, xUV)));
+      const int x1 = static_cast<int>(std::ceil(std::max(xAC, xUV)));
+      if (x0 < x1)
+        fn(y, x0, x1);
+    }
+  }
+}
+
+
+#endif